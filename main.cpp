@@ -5,295 +5,5090 @@
 #include <cstdint>
 #include <valarray> // This include is needed for declval
 #include <cmath>
+#include <cstring>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
 #include <algorithm>
 #include <iomanip>
+#include <sstream>
+#include <functional>
+#include <thread>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
 #include <boost/math/distributions/chi_squared.hpp>
 using namespace std;
 
-class HashFunctionTester {
+// Fixed-size thread pool in which every worker owns a deque of tasks.
+// A worker runs its newest task first and, once its own deque is empty, steals
+// the oldest task of another worker, so tiny and huge jobs balance across cores.
+class WorkStealingPool {
 private:
-    // Create an empty vector to store each word<string> in wordlist
-    vector<string> words;
+    // Stores the tasks owned by one worker together with the lock guarding them
+    struct WorkerQueue {
+        deque<function<void()>> tasks;
+        mutex lock;
+    };
+
+    // Define vector of per-worker task queues
+    vector<unique_ptr<WorkerQueue>> queues;
+
+    // Define vector of worker threads
+    vector<thread> workers;
+
+    // Number of tasks sitting in a queue, and number of tasks submitted but not yet finished
+    atomic<size_t> queuedTasks{0};
+    atomic<size_t> pendingTasks{0};
+
+    // Round-robin index used to spread tasks submitted from outside the pool
+    atomic<size_t> nextQueue{0};
+
+    // Set when the pool is being destroyed
+    bool stopping = false;
+
+    // Lock and condition variables used to park idle workers and to wait for completion
+    mutex idleLock;
+    condition_variable workAvailable;
+    condition_variable allDone;
+
+    // Pool and worker index of the calling thread, used to push new tasks onto the local deque
+    static thread_local WorkStealingPool* currentPool;
+    static thread_local size_t currentWorker;
+
+    // Pop the newest task from the worker's own deque
+    bool popLocal(size_t index, function<void()>& task) {
+        lock_guard<mutex> guard(queues[index]->lock);
+        if (queues[index]->tasks.empty()) {
+            return false;
+        }
+        task = move(queues[index]->tasks.back());
+        queues[index]->tasks.pop_back();
+        queuedTasks--;
+        return true;
+    }
+
+    // Steal the oldest task from the first other worker that has one
+    bool steal(size_t index, function<void()>& task) {
+        for (size_t offset = 1; offset < queues.size(); ++offset) {
+            WorkerQueue& victim = *queues[(index + offset) % queues.size()];
+            lock_guard<mutex> guard(victim.lock);
+            if (!victim.tasks.empty()) {
+                task = move(victim.tasks.front());
+                victim.tasks.pop_front();
+                queuedTasks--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Main loop of a worker thread
+    void workerLoop(size_t index) {
+        currentPool = this;
+        currentWorker = index;
+
+        function<void()> task;
+        while (true) {
+            // Run local work first, then try to steal
+            if (popLocal(index, task) || steal(index, task)) {
+                task();
+                task = nullptr;
+
+                // Wake up wait() once the last outstanding task has finished
+                if (--pendingTasks == 0) {
+                    lock_guard<mutex> guard(idleLock);
+                    allDone.notify_all();
+                }
+                continue;
+            }
+
+            // Sleep until a task is queued or the pool shuts down
+            unique_lock<mutex> guard(idleLock);
+            workAvailable.wait(guard, [this]() { return queuedTasks > 0 || stopping; });
+            if (stopping && queuedTasks == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+
+    // Start one worker per requested thread (at least one)
+    explicit WorkStealingPool(size_t threadCount = thread::hardware_concurrency()) {
+        threadCount = max<size_t>(1, threadCount);
+        for (size_t i = 0; i < threadCount; ++i) {
+            queues.emplace_back(new WorkerQueue());
+        }
+        for (size_t i = 0; i < threadCount; ++i) {
+            workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+        }
+    }
+
+    // Let the workers drain their queues and join them
+    ~WorkStealingPool() {
+        {
+            lock_guard<mutex> guard(idleLock);
+            stopping = true;
+        }
+        workAvailable.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    // Return the number of worker threads
+    size_t size() const {
+        return workers.size();
+    }
+
+    // Queue a task; tasks submitted by a worker go to that worker's own deque
+    void submit(function<void()> task) {
+        size_t index = (currentPool == this) ? currentWorker : nextQueue++ % queues.size();
+        pendingTasks++;
+        {
+            lock_guard<mutex> guard(queues[index]->lock);
+            queues[index]->tasks.push_back(move(task));
+            queuedTasks++;
+        }
+        lock_guard<mutex> guard(idleLock);
+        workAvailable.notify_one();
+    }
+
+    // Block until every submitted task has finished; must not be called from a worker
+    void wait() {
+        unique_lock<mutex> guard(idleLock);
+        allDone.wait(guard, [this]() { return pendingTasks == 0; });
+    }
+};
+
+thread_local WorkStealingPool* WorkStealingPool::currentPool = nullptr;
+thread_local size_t WorkStealingPool::currentWorker = 0;
+
+// Chi-square tail probabilities in log space for any number of degrees of freedom.
+// Small df use the series and continued fraction of the regularized incomplete gamma function.
+// Large df use Temme's uniform asymptotic expansion with its first correction term, whose relative
+// error is O(1/df^2) near the centre and O(1/df) far into the tails, where Wilson-Hilferty breaks down.
+// The per-df constants are cached, so a lookup costs a few hundred nanoseconds at most.
+class ChiSquareTailEngine {
+public:
+    // Natural logarithms of the lower tail P(X <= x) and the upper tail P(X >= x)
+    struct Tails {
+        double logLower;
+        double logUpper;
+    };
+
+    // Compute both tails for a chi-square statistic with the given degrees of freedom
+    Tails tails(double chiSquare, double degreesOfFreedom) {
+        const Distribution& distribution = lookup(degreesOfFreedom);
+        double x = chiSquare / 2.0;
+
+        // The statistic cannot be negative; zero is the bottom of the support
+        if (x <= 0.0) {
+            return { -numeric_limits<double>::infinity(), 0.0 };
+        }
+
+        if (degreesOfFreedom >= ASYMPTOTIC_DEGREES_OF_FREEDOM) {
+            return temme(distribution, x);
+        }
+
+        // Compute the tail whose expansion converges, and the other as its complement
+        if (x < distribution.a + 1.0) {
+            double logLower = logLowerSeries(distribution, x);
+            return { logLower, log1mexp(logLower) };
+        }
+        double logUpper = logUpperContinuedFraction(distribution, x);
+        return { log1mexp(logUpper), logUpper };
+    }
+
+private:
+    // Stores the constants that depend only on the degrees of freedom
+    struct Distribution {
+        double a;                 // Shape of the gamma distribution, df / 2
+        double logGammaA;         // log(Gamma(a))
+        double logSqrtTwoPiA;     // log(sqrt(2 * pi * a))
+    };
+
+    // Degrees of freedom from which the asymptotic expansion is used
+    static constexpr double ASYMPTOTIC_DEGREES_OF_FREEDOM = 200.0;
+
+    // Cache of per-df constants, guarded by a lock because sweeps call in from many threads
+    mutex cacheLock;
+    unordered_map<double, Distribution> cache;
+
+    // Return the cached constants for the given degrees of freedom
+    const Distribution& lookup(double degreesOfFreedom) {
+        lock_guard<mutex> guard(cacheLock);
+        auto found = cache.find(degreesOfFreedom);
+        if (found != cache.end()) {
+            return found->second;
+        }
+        double a = degreesOfFreedom / 2.0;
+        Distribution distribution = { a, lgamma(a), 0.5 * log(2.0 * M_PI * a) };
+        return cache.emplace(degreesOfFreedom, distribution).first->second;
+    }
+
+    // Return log(1 - e^l) for l <= 0 without cancellation
+    static double log1mexp(double l) {
+        return l > -M_LN2 ? log(-expm1(l)) : log1p(-exp(l));
+    }
+
+    // log P(a, x) from the power series, for x < a + 1
+    static double logLowerSeries(const Distribution& distribution, double x) {
+        double term = 1.0 / distribution.a;
+        double sum = term;
+        for (double n = distribution.a + 1.0; term > sum * 1e-17; n += 1.0) {
+            term *= x / n;
+            sum += term;
+        }
+        return log(sum) - x + distribution.a * log(x) - distribution.logGammaA;
+    }
+
+    // log Q(a, x) from the continued fraction (modified Lentz), for x >= a + 1
+    static double logUpperContinuedFraction(const Distribution& distribution, double x) {
+        const double tiny = 1e-300;
+        double b = x + 1.0 - distribution.a;
+        double c = 1.0 / tiny;
+        double d = 1.0 / b;
+        double h = d;
+        for (int i = 1; i < 100000; ++i) {
+            double an = -i * (i - distribution.a);
+            b += 2.0;
+            d = an * d + b;
+            d = fabs(d) < tiny ? tiny : d;
+            c = b + an / c;
+            c = fabs(c) < tiny ? tiny : c;
+            d = 1.0 / d;
+            double delta = d * c;
+            h *= delta;
+            if (fabs(delta - 1.0) < 1e-16) {
+                break;
+            }
+        }
+        return log(h) - x + distribution.a * log(x) - distribution.logGammaA;
+    }
+
+    // Temme's uniform expansion: Q(a, x) = erfc(w / sqrt(2)) / 2 + e^(-w^2 / 2) / sqrt(2 pi a) * c0,
+    // with mu = x / a - 1, eta = sign(mu) * sqrt(2 (mu - log(1 + mu))), w = eta * sqrt(a), c0 = 1 / mu - 1 / eta
+    static Tails temme(const Distribution& distribution, double x) {
+        double mu = x / distribution.a - 1.0;
+        double eta = copysign(sqrt(2.0 * (mu - log1p(mu))), mu);
+        double w = eta * sqrt(distribution.a);
+        double logPrefix = -0.5 * w * w - distribution.logSqrtTwoPiA;
+
+        // c0 has a removable singularity at mu = 0, where it tends to -1/3 + mu / 12
+        double c0 = fabs(mu) < 1e-4 ? -1.0 / 3.0 + mu / 12.0 : 1.0 / mu - 1.0 / eta;
+
+        // Far in a tail, erfc underflows; use its asymptotic series instead, which folds into
+        // tail = prefix * |1 / mu - (1 / eta) (1 / w^2 - 3 / w^4)|
+        const double farTail = 30.0;
+        if (fabs(w) > farTail) {
+            double inverseSquare = 1.0 / (w * w);
+            double logTail = logPrefix + log(fabs(1.0 / mu - (inverseSquare - 3.0 * inverseSquare * inverseSquare) / eta));
+            return w > 0.0 ? Tails{ log1mexp(logTail), logTail } : Tails{ logTail, log1mexp(logTail) };
+        }
+
+        // Otherwise compute the smaller tail directly and the larger one as its complement
+        double correction = exp(logPrefix) * c0;
+        if (w > 0.0) {
+            double logUpper = log(0.5 * erfc(w / M_SQRT2) + correction);
+            return { log1mexp(logUpper), logUpper };
+        }
+        double logLower = log(0.5 * erfc(-w / M_SQRT2) - correction);
+        return { logLower, log1mexp(logLower) };
+    }
+};
+
+constexpr double ChiSquareTailEngine::ASYMPTOTIC_DEGREES_OF_FREEDOM;
+
+// Chi-square statistic updated as keys arrive, with a sequential test run at regular checkpoints.
+// Adding a key to a bucket that holds c keys raises sum(c^2) by 2c + 1, so the exact statistic is
+// available at every checkpoint in O(1). The test stops as soon as the upper tail at a checkpoint falls
+// below alpha divided by the number of planned checkpoints (a Bonferroni split), which keeps the chance
+// of stopping a uniform hash early below alpha overall. Only rejection can be settled early; a hash that
+// looks uniform so far still has to see the whole corpus.
+class SequentialChiSquareTest {
+private:
+    ChiSquareTailEngine& engine;
+    vector<uint32_t> counts;
+    uint64_t sumOfSquares = 0;
+    size_t keysSeen = 0;
+    size_t checkpointInterval;
+    size_t firstCheckpoint;
+    double logAlphaPerCheckpoint;
+    bool rejected = false;
+
+public:
+
+    // Plan one checkpoint every checkpointInterval keys out of totalKeys; the first checkpoint waits until
+    // a quarter of a key per bucket is expected, so the collision count behind the statistic is not too sparse
+    SequentialChiSquareTest(ChiSquareTailEngine& engine, size_t bucketCount, size_t totalKeys,
+        size_t checkpointInterval, double confidence)
+        : engine(engine), counts(bucketCount, 0), checkpointInterval(checkpointInterval) {
+        firstCheckpoint = max(checkpointInterval, bucketCount / 4);
+        double plannedCheckpoints = max<size_t>(1, totalKeys / checkpointInterval);
+        logAlphaPerCheckpoint = log((1.0 - confidence) / plannedCheckpoints);
+    }
+
+    // Add one key to its bucket; returns true once the hash has been rejected and evaluation can stop
+    bool add(size_t bucket) {
+        sumOfSquares += 2 * static_cast<uint64_t>(counts[bucket]++) + 1;
+        keysSeen++;
+        if (keysSeen >= firstCheckpoint && keysSeen % checkpointInterval == 0) {
+            rejected = engine.tails(chiSquare(), counts.size() - 1.0).logUpper < logAlphaPerCheckpoint;
+        }
+        return rejected;
+    }
+
+    // Chi-square statistic of the keys added so far: (B * sum(c^2) - n^2) / n
+    double chiSquare() const {
+        __int128 keys = keysSeen;
+        __int128 numerator = static_cast<__int128>(counts.size()) * sumOfSquares - keys * keys;
+        return keysSeen == 0 ? 0.0 : static_cast<double>(numerator) / keysSeen;
+    }
+
+    // Return the number of keys added so far
+    size_t keyCount() const {
+        return keysSeen;
+    }
+
+    // Return whether the test stopped at a checkpoint
+    bool isRejected() const {
+        return rejected;
+    }
+};
+
+// One-byte bucket counters for tables whose loads are mostly tiny (about 1.5 keys per bucket in a sweep)
+// A counter that reaches SATURATED stays there and the rest of its load spills into a sparse map, so heavy
+// buckets cost memory only when they occur; a 2^32-bucket table takes 4 GiB instead of 16 with int counters
+class CompactCounterArray {
+private:
+    vector<uint8_t> counts;
+    unordered_map<size_t, uint64_t> spill;
+
+public:
+    static constexpr uint8_t SATURATED = 255;
+
+    explicit CompactCounterArray(size_t bucketCount) : counts(bucketCount, 0) {}
+
+    // Add one key to a bucket
+    void increment(size_t bucket) {
+        if (counts[bucket] != SATURATED) {
+            counts[bucket]++;
+        } else {
+            spill[bucket]++;
+        }
+    }
+
+    // Return the exact load of a bucket
+    uint64_t load(size_t bucket) const {
+        if (counts[bucket] != SATURATED) {
+            return counts[bucket];
+        }
+        auto spilled = spill.find(bucket);
+        return SATURATED + (spilled == spill.end() ? 0 : spilled->second);
+    }
+
+    // Return the number of buckets
+    size_t size() const {
+        return counts.size();
+    }
+
+    // Return the byte counters; a saturated counter reads SATURATED and its remainder is in spilled()
+    const uint8_t* data() const {
+        return counts.data();
+    }
+
+    // Return the load above SATURATED of every bucket that overflowed its byte
+    const unordered_map<size_t, uint64_t>& spilled() const {
+        return spill;
+    }
+
+    // Reset every counter to 0
+    void clear() {
+        fill(counts.begin(), counts.end(), 0);
+        spill.clear();
+    }
+};
+
+constexpr uint8_t CompactCounterArray::SATURATED;
+
+// HyperLogLog sketch of the number of distinct 64-bit values added to it, in 2^PRECISION one-byte registers
+// Each value picks a register with its top PRECISION bits and offers it the position of the first 1 bit in the
+// rest; sketches of disjoint parts of a stream merge by taking the register-wise maximum
+// Values should already be well mixed; callers pass them through a 64-bit finalizer
+class HyperLogLog {
+private:
+    static constexpr int PRECISION = 14;
+    static constexpr size_t REGISTER_COUNT = size_t(1) << PRECISION;
+    vector<uint8_t> registers;
+
+public:
+    HyperLogLog() : registers(REGISTER_COUNT, 0) {}
+
+    // Add one value
+    void add(uint64_t value) {
+        size_t index = value >> (64 - PRECISION);
+        uint64_t rest = value << PRECISION;
+        uint8_t rank = rest == 0 ? 64 - PRECISION + 1 : __builtin_clzll(rest) + 1;
+        registers[index] = max(registers[index], rank);
+    }
+
+    // Merge another sketch into this one; the byte-wise maximum vectorizes
+    void merge(const HyperLogLog& other) {
+        uint8_t* target = registers.data();
+        const uint8_t* source = other.registers.data();
+        for (size_t i = 0; i < REGISTER_COUNT; ++i) {
+            target[i] = max(target[i], source[i]);
+        }
+    }
+
+    // Estimate the number of distinct values with Ertl's improved raw estimator, alpha m^2 / z: z is the sum of
+    // 2^-register with the empty and the saturated registers replaced by the sigma and tau series, which keeps
+    // the estimate unbiased from a few values up, with no switch to linear counting and no bias tables
+    double estimate() const {
+
+        // Tally the registers by value first, so the sum needs only one power of two per value
+        vector<uint32_t> tally(66, 0);
+        for (uint8_t value : registers) {
+            tally[value]++;
+        }
+
+        // Horner's scheme over the register values, from the saturated one down to 1
+        double m = static_cast<double>(REGISTER_COUNT);
+        int q = 64 - PRECISION;
+        double z = m * tau(1.0 - tally[q + 1] / m);
+        for (int value = q; value >= 1; --value) {
+            z = 0.5 * (z + tally[value]);
+        }
+        z += m * sigma(tally[0] / m);
+        return 0.5 / log(2.0) * m * m / z;
+    }
+
+    // sigma(x) = x + sum over k >= 1 of x^(2^k) 2^(k - 1), the correction for a fraction x of empty registers
+    static double sigma(double x) {
+        if (x == 1.0) {
+            return INFINITY;
+        }
+        double weight = 1.0;
+        double sum = x;
+        double previous;
+        do {
+            x *= x;
+            previous = sum;
+            sum += x * weight;
+            weight += weight;
+        } while (sum != previous);
+        return sum;
+    }
+
+    // tau(x) = (1 - x - sum over k >= 1 of (1 - x^(2^-k))^2 2^-k) / 3, the correction for a fraction 1 - x
+    // of saturated registers
+    static double tau(double x) {
+        if (x == 0.0 || x == 1.0) {
+            return 0.0;
+        }
+        double weight = 1.0;
+        double sum = 1.0 - x;
+        double previous;
+        do {
+            x = sqrt(x);
+            previous = sum;
+            weight *= 0.5;
+            sum -= (1.0 - x) * (1.0 - x) * weight;
+        } while (sum != previous);
+        return sum / 3.0;
+    }
+
+    // Return the relative standard error of the estimate, 1.04 / sqrt(m)
+    static double standardError() {
+        return 1.04 / sqrt(static_cast<double>(REGISTER_COUNT));
+    }
+};
+
+constexpr int HyperLogLog::PRECISION;
+constexpr size_t HyperLogLog::REGISTER_COUNT;
+
+// XXH64, written from the xxHash specification: four 64-bit lanes consume 32-byte stripes, then the lanes are
+// merged and the remaining 0-31 bytes are folded in 8, 4 and 1 bytes at a time
+class XXHash64 {
+private:
+    static constexpr uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+    static constexpr uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+    static constexpr uint64_t PRIME4 = 0x85EBCA77C2B2AE63ULL;
+    static constexpr uint64_t PRIME5 = 0x27D4EB2F165667C5ULL;
+
+    static uint64_t read64(const uint8_t* p) {
+        uint64_t value;
+        memcpy(&value, p, 8);
+        return value;
+    }
+    static uint32_t read32(const uint8_t* p) {
+        uint32_t value;
+        memcpy(&value, p, 4);
+        return value;
+    }
+    static uint64_t rotateLeft(uint64_t x, int r) {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    // Mix 8 input bytes into one lane
+    static uint64_t round(uint64_t lane, uint64_t input) {
+        return rotateLeft(lane + input * PRIME2, 31) * PRIME1;
+    }
+
+    // Fold one lane into the merged state
+    static uint64_t mergeRound(uint64_t h, uint64_t lane) {
+        return (h ^ round(0, lane)) * PRIME1 + PRIME4;
+    }
+
+public:
+    // Final avalanche of XXH64, also used by the shortest XXH3 paths
+    static uint64_t avalanche(uint64_t h) {
+        h ^= h >> 33;
+        h *= PRIME2;
+        h ^= h >> 29;
+        h *= PRIME3;
+        h ^= h >> 32;
+        return h;
+    }
+
+    // Hash `length` bytes
+    static uint64_t hash(const void* data, size_t length, uint64_t seed = 0) {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        const uint8_t* end = p + length;
+
+        uint64_t h;
+        if (length >= 32) {
+            uint64_t v1 = seed + PRIME1 + PRIME2;
+            uint64_t v2 = seed + PRIME2;
+            uint64_t v3 = seed;
+            uint64_t v4 = seed - PRIME1;
+            for (; p + 32 <= end; p += 32) {
+                v1 = round(v1, read64(p));
+                v2 = round(v2, read64(p + 8));
+                v3 = round(v3, read64(p + 16));
+                v4 = round(v4, read64(p + 24));
+            }
+            h = rotateLeft(v1, 1) + rotateLeft(v2, 7) + rotateLeft(v3, 12) + rotateLeft(v4, 18);
+            h = mergeRound(h, v1);
+            h = mergeRound(h, v2);
+            h = mergeRound(h, v3);
+            h = mergeRound(h, v4);
+        }
+        else {
+            h = seed + PRIME5;
+        }
+        h += length;
+
+        for (; p + 8 <= end; p += 8) {
+            h = rotateLeft(h ^ round(0, read64(p)), 27) * PRIME1 + PRIME4;
+        }
+        if (p + 4 <= end) {
+            h = rotateLeft(h ^ read32(p) * PRIME1, 23) * PRIME2 + PRIME3;
+            p += 4;
+        }
+        for (; p < end; ++p) {
+            h = rotateLeft(h ^ *p * PRIME5, 11) * PRIME1;
+        }
+        return avalanche(h);
+    }
+};
+
+constexpr uint64_t XXHash64::PRIME1;
+constexpr uint64_t XXHash64::PRIME2;
+constexpr uint64_t XXHash64::PRIME3;
+constexpr uint64_t XXHash64::PRIME4;
+constexpr uint64_t XXHash64::PRIME5;
+
+// XXH3 with a 64-bit output and seed 0, written from the xxHash specification
+// Keys up to 240 bytes take one of four short paths (0-16, 17-128 and 129-240 bytes, the first split again
+// at 4 and 9 bytes). Longer keys are cut into 64-byte stripes: every stripe is mixed into eight 64-bit
+// accumulators with its own 64-byte window of the secret, and after every block of 16 stripes the
+// accumulators are scrambled. The stripe kernel runs in scalar code, SSE2 or AVX2 lanes, chosen once at run
+// time from what the CPU supports; all kernels give the same hash.
+// Besides the one-shot hash(), an object hashes a key that arrives in pieces through update() and digest().
+// Loads are little-endian, like the x86 targets this runs on.
+class XXHash3 {
+public:
+    // Stores a stripe kernel: accumulate consecutive stripes, each against a secret window 8 bytes further
+    // along, and scramble the accumulators at the end of a block
+    struct Kernel {
+        string name;
+        void (*accumulate)(uint64_t* accumulators, const uint8_t* input, const uint8_t* secret, size_t stripeCount);
+        void (*scramble)(uint64_t* accumulators, const uint8_t* secret);
+    };
+
+private:
+    static constexpr size_t STRIPE_LENGTH = 64;
+    static constexpr size_t SECRET_SIZE = 192;
+    static constexpr size_t SECRET_CONSUME_RATE = 8;
+    static constexpr size_t STRIPES_PER_BLOCK = (SECRET_SIZE - STRIPE_LENGTH) / SECRET_CONSUME_RATE;
+    static constexpr size_t MIDSIZE_MAX = 240;
+    static constexpr size_t BUFFER_SIZE = 256;
+    static constexpr uint32_t PRIME32_1 = 0x9E3779B1u;
+    static constexpr uint32_t PRIME32_2 = 0x85EBCA77u;
+    static constexpr uint32_t PRIME32_3 = 0xC2B2AE3Du;
+    static constexpr uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+    static constexpr uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+    static constexpr uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+    static constexpr uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+    // The default secret of the specification
+    static constexpr uint8_t SECRET[SECRET_SIZE] = {
+        0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+        0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+        0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+        0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+        0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+        0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+        0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+        0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+        0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+        0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+        0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+        0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+    };
+
+    // Streaming state: the accumulators, the stripes consumed in the current block, and a buffer that holds
+    // the unconsumed input; input is only consumed once more follows it, so the last stripe is always at hand
+    alignas(32) uint64_t accumulators[8];
+    uint8_t buffer[BUFFER_SIZE];
+    size_t bufferedSize;
+    size_t stripesSoFar;
+    uint64_t totalLength;
+    const Kernel* kernel;
+
+    static uint64_t read64(const uint8_t* p) {
+        uint64_t value;
+        memcpy(&value, p, 8);
+        return value;
+    }
+    static uint32_t read32(const uint8_t* p) {
+        uint32_t value;
+        memcpy(&value, p, 4);
+        return value;
+    }
+
+    // Multiply two 64-bit values to 128 bits and xor the halves together
+    static uint64_t multiplyFold64(uint64_t a, uint64_t b) {
+        unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+    }
+
+    // Final avalanche of the 9-byte and longer paths
+    static uint64_t avalanche(uint64_t h) {
+        h ^= h >> 37;
+        h *= 0x165667919E3779F9ULL;
+        h ^= h >> 32;
+        return h;
+    }
+
+    // Final mix of the 4-8 byte path
+    static uint64_t rrmxmx(uint64_t h, uint64_t length) {
+        h ^= ((h << 49) | (h >> 15)) ^ ((h << 24) | (h >> 40));
+        h *= 0x9FB21C651E98DF25ULL;
+        h ^= (h >> 35) + length;
+        h *= 0x9FB21C651E98DF25ULL;
+        return h ^ (h >> 28);
+    }
+
+    // Mix 16 input bytes with 16 secret bytes
+    static uint64_t mix16(const uint8_t* input, const uint8_t* secret) {
+        return multiplyFold64(read64(input) ^ read64(secret), read64(input + 8) ^ read64(secret + 8));
+    }
+
+    // Keys of 0-16 bytes: one or two overlapping loads cover the whole key
+    static uint64_t hashUpTo16(const uint8_t* input, size_t length) {
+        if (length > 8) {
+            uint64_t low = read64(input) ^ (read64(SECRET + 24) ^ read64(SECRET + 32));
+            uint64_t high = read64(input + length - 8) ^ (read64(SECRET + 40) ^ read64(SECRET + 48));
+            return avalanche(length + __builtin_bswap64(low) + high + multiplyFold64(low, high));
+        }
+        if (length >= 4) {
+            uint64_t combined = read32(input + length - 4) + (static_cast<uint64_t>(read32(input)) << 32);
+            return rrmxmx(combined ^ (read64(SECRET + 8) ^ read64(SECRET + 16)), length);
+        }
+        if (length > 0) {
+            uint32_t combined = (static_cast<uint32_t>(input[0]) << 16) | (static_cast<uint32_t>(input[length >> 1]) << 24)
+                | input[length - 1] | (static_cast<uint32_t>(length) << 8);
+            return XXHash64::avalanche(combined ^ static_cast<uint64_t>(read32(SECRET) ^ read32(SECRET + 4)));
+        }
+        return XXHash64::avalanche(read64(SECRET + 56) ^ read64(SECRET + 64));
+    }
+
+    // Keys of 17-128 bytes: pairs of 16-byte blocks taken from both ends, working inwards
+    static uint64_t hash17To128(const uint8_t* input, size_t length) {
+        uint64_t acc = length * PRIME64_1;
+        if (length > 32) {
+            if (length > 64) {
+                if (length > 96) {
+                    acc += mix16(input + 48, SECRET + 96);
+                    acc += mix16(input + length - 64, SECRET + 112);
+                }
+                acc += mix16(input + 32, SECRET + 64);
+                acc += mix16(input + length - 48, SECRET + 80);
+            }
+            acc += mix16(input + 16, SECRET + 32);
+            acc += mix16(input + length - 32, SECRET + 48);
+        }
+        acc += mix16(input, SECRET);
+        acc += mix16(input + length - 16, SECRET + 16);
+        return avalanche(acc);
+    }
+
+    // Keys of 129-240 bytes: every 16-byte block, with an avalanche after the first eight
+    static uint64_t hash129To240(const uint8_t* input, size_t length) {
+        uint64_t acc = length * PRIME64_1;
+        for (size_t i = 0; i < 8; ++i) {
+            acc += mix16(input + 16 * i, SECRET + 16 * i);
+        }
+        acc = avalanche(acc);
+        for (size_t i = 8; i < length / 16; ++i) {
+            acc += mix16(input + 16 * i, SECRET + 16 * (i - 8) + 3);
+        }
+        acc += mix16(input + length - 16, SECRET + 136 - 17);
+        return avalanche(acc);
+    }
+
+    // Set the accumulators to their initial values
+    static void initializeAccumulators(uint64_t* acc) {
+        const uint64_t initial[8] = { PRIME32_3, PRIME64_1, PRIME64_2, PRIME64_3, PRIME64_4, PRIME32_2, PRIME64_5, PRIME32_1 };
+        memcpy(acc, initial, sizeof(initial));
+    }
+
+    // Accumulate the last stripe, which always ends at the end of the key, against a fixed secret window
+    static void accumulateLastStripe(const Kernel& kernel, uint64_t* acc, const uint8_t* lastStripe) {
+        kernel.accumulate(acc, lastStripe, SECRET + SECRET_SIZE - STRIPE_LENGTH - 7, 1);
+    }
+
+    // Merge the eight accumulators into the 64-bit hash
+    static uint64_t mergeAccumulators(const uint64_t* acc, uint64_t length) {
+        uint64_t result = length * PRIME64_1;
+        for (int i = 0; i < 4; ++i) {
+            result += multiplyFold64(acc[2 * i] ^ read64(SECRET + 11 + 16 * i), acc[2 * i + 1] ^ read64(SECRET + 11 + 16 * i + 8));
+        }
+        return avalanche(result);
+    }
+
+    // Accumulate stripes that continue the current block, scrambling whenever a block fills up
+    static void consumeStripes(const Kernel& kernel, uint64_t* acc, size_t& stripesSoFar, const uint8_t* input, size_t stripeCount) {
+        while (stripeCount > 0) {
+            size_t stripesToBlockEnd = STRIPES_PER_BLOCK - stripesSoFar;
+            if (stripeCount < stripesToBlockEnd) {
+                kernel.accumulate(acc, input, SECRET + stripesSoFar * SECRET_CONSUME_RATE, stripeCount);
+                stripesSoFar += stripeCount;
+                return;
+            }
+            kernel.accumulate(acc, input, SECRET + stripesSoFar * SECRET_CONSUME_RATE, stripesToBlockEnd);
+            kernel.scramble(acc, SECRET + SECRET_SIZE - STRIPE_LENGTH);
+            input += stripesToBlockEnd * STRIPE_LENGTH;
+            stripeCount -= stripesToBlockEnd;
+            stripesSoFar = 0;
+        }
+    }
+
+    // Keys longer than 240 bytes: whole blocks, the stripes of the last partial block, then the last stripe
+    static uint64_t hashLong(const Kernel& kernel, const uint8_t* input, size_t length) {
+        alignas(32) uint64_t acc[8];
+        initializeAccumulators(acc);
+        size_t stripesSoFar = 0;
+        consumeStripes(kernel, acc, stripesSoFar, input, (length - 1) / STRIPE_LENGTH);
+        accumulateLastStripe(kernel, acc, input + length - STRIPE_LENGTH);
+        return mergeAccumulators(acc, length);
+    }
+
+    // Scalar stripe kernel: for each 8-byte lane, add the input to the neighbouring accumulator and the
+    // product of the two 32-bit halves of input ^ secret to its own
+    static void accumulateScalar(uint64_t* acc, const uint8_t* input, const uint8_t* secret, size_t stripeCount) {
+        for (size_t stripe = 0; stripe < stripeCount; ++stripe) {
+            const uint8_t* data = input + stripe * STRIPE_LENGTH;
+            const uint8_t* key = secret + stripe * SECRET_CONSUME_RATE;
+            for (int lane = 0; lane < 8; ++lane) {
+                uint64_t value = read64(data + 8 * lane);
+                uint64_t keyed = value ^ read64(key + 8 * lane);
+                acc[lane ^ 1] += value;
+                acc[lane] += (keyed & 0xFFFFFFFF) * (keyed >> 32);
+            }
+        }
+    }
+    static void scrambleScalar(uint64_t* acc, const uint8_t* secret) {
+        for (int lane = 0; lane < 8; ++lane) {
+            uint64_t value = acc[lane];
+            value ^= value >> 47;
+            value ^= read64(secret + 8 * lane);
+            acc[lane] = value * PRIME32_1;
+        }
+    }
+
+#ifdef __SSE2__
+    // SSE2 stripe kernel: two lanes per register; the 32x32-bit products come from _mm_mul_epu32 and the
+    // neighbouring-lane add from swapping the two halves of the input
+    static void accumulateSse2(uint64_t* acc, const uint8_t* input, const uint8_t* secret, size_t stripeCount) {
+        __m128i lanes[4];
+        for (int i = 0; i < 4; ++i) {
+            lanes[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc) + i);
+        }
+        for (size_t stripe = 0; stripe < stripeCount; ++stripe) {
+            const __m128i* data = reinterpret_cast<const __m128i*>(input + stripe * STRIPE_LENGTH);
+            const __m128i* key = reinterpret_cast<const __m128i*>(secret + stripe * SECRET_CONSUME_RATE);
+            for (int i = 0; i < 4; ++i) {
+                __m128i value = _mm_loadu_si128(data + i);
+                __m128i keyed = _mm_xor_si128(value, _mm_loadu_si128(key + i));
+                __m128i product = _mm_mul_epu32(keyed, _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+                __m128i swapped = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+                lanes[i] = _mm_add_epi64(lanes[i], _mm_add_epi64(product, swapped));
+            }
+        }
+        for (int i = 0; i < 4; ++i) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(acc) + i, lanes[i]);
+        }
+    }
+    static void scrambleSse2(uint64_t* acc, const uint8_t* secret) {
+        const __m128i prime = _mm_set1_epi32(static_cast<int>(PRIME32_1));
+        for (int i = 0; i < 4; ++i) {
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc) + i);
+            value = _mm_xor_si128(value, _mm_srli_epi64(value, 47));
+            value = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i));
+            __m128i low = _mm_mul_epu32(value, prime);
+            __m128i high = _mm_mul_epu32(_mm_shuffle_epi32(value, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(acc) + i, _mm_add_epi64(low, _mm_slli_epi64(high, 32)));
+        }
+    }
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+    // AVX2 stripe kernel: the SSE2 kernel on four lanes per register; compiled for AVX2 whatever the build
+    // flags, and only called when the CPU reports AVX2
+    __attribute__((target("avx2")))
+    static void accumulateAvx2(uint64_t* acc, const uint8_t* input, const uint8_t* secret, size_t stripeCount) {
+        __m256i lanes[2];
+        for (int i = 0; i < 2; ++i) {
+            lanes[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc) + i);
+        }
+        for (size_t stripe = 0; stripe < stripeCount; ++stripe) {
+            const __m256i* data = reinterpret_cast<const __m256i*>(input + stripe * STRIPE_LENGTH);
+            const __m256i* key = reinterpret_cast<const __m256i*>(secret + stripe * SECRET_CONSUME_RATE);
+            for (int i = 0; i < 2; ++i) {
+                __m256i value = _mm256_loadu_si256(data + i);
+                __m256i keyed = _mm256_xor_si256(value, _mm256_loadu_si256(key + i));
+                __m256i product = _mm256_mul_epu32(keyed, _mm256_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+                __m256i swapped = _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+                lanes[i] = _mm256_add_epi64(lanes[i], _mm256_add_epi64(product, swapped));
+            }
+        }
+        for (int i = 0; i < 2; ++i) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc) + i, lanes[i]);
+        }
+    }
+    __attribute__((target("avx2")))
+    static void scrambleAvx2(uint64_t* acc, const uint8_t* secret) {
+        const __m256i prime = _mm256_set1_epi32(static_cast<int>(PRIME32_1));
+        for (int i = 0; i < 2; ++i) {
+            __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc) + i);
+            value = _mm256_xor_si256(value, _mm256_srli_epi64(value, 47));
+            value = _mm256_xor_si256(value, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret) + i));
+            __m256i low = _mm256_mul_epu32(value, prime);
+            __m256i high = _mm256_mul_epu32(_mm256_shuffle_epi32(value, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc) + i, _mm256_add_epi64(low, _mm256_slli_epi64(high, 32)));
+        }
+    }
+#endif
+
+public:
+    // Return every stripe kernel this build and CPU can run, the fastest last
+    static const vector<Kernel>& kernels() {
+        static const vector<Kernel> available = [] {
+            vector<Kernel> result = { { "scalar", accumulateScalar, scrambleScalar } };
+#ifdef __SSE2__
+            result.push_back({ "SSE2", accumulateSse2, scrambleSse2 });
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) {
+                result.push_back({ "AVX2", accumulateAvx2, scrambleAvx2 });
+            }
+#endif
+            return result;
+        }();
+        return available;
+    }
+
+    // Return the kernel used unless another one is asked for
+    static const Kernel& defaultKernel() {
+        return kernels().back();
+    }
+
+    // Hash `length` bytes in one call
+    static uint64_t hash(const void* data, size_t length, const Kernel& kernel = defaultKernel()) {
+        const uint8_t* input = static_cast<const uint8_t*>(data);
+        if (length <= 16) {
+            return hashUpTo16(input, length);
+        }
+        if (length <= 128) {
+            return hash17To128(input, length);
+        }
+        if (length <= MIDSIZE_MAX) {
+            return hash129To240(input, length);
+        }
+        return hashLong(kernel, input, length);
+    }
+
+    // Start an empty streaming hash
+    explicit XXHash3(const Kernel& kernel = defaultKernel()) : kernel(&kernel) {
+        reset();
+    }
+
+    // Forget all input given so far
+    void reset() {
+        initializeAccumulators(accumulators);
+        bufferedSize = 0;
+        stripesSoFar = 0;
+        totalLength = 0;
+    }
+
+    // Append `length` bytes to the key
+    void update(const void* data, size_t length) {
+        const uint8_t* input = static_cast<const uint8_t*>(data);
+        const uint8_t* end = input + length;
+        totalLength += length;
+
+        // Small pieces only fill the buffer
+        if (bufferedSize + length <= BUFFER_SIZE) {
+            memcpy(buffer + bufferedSize, input, length);
+            bufferedSize += length;
+            return;
+        }
+
+        // Complete the buffer and consume it whole; more input follows, so none of it is the last stripe
+        if (bufferedSize > 0) {
+            size_t fill = BUFFER_SIZE - bufferedSize;
+            memcpy(buffer + bufferedSize, input, fill);
+            input += fill;
+            consumeStripes(*kernel, accumulators, stripesSoFar, buffer, BUFFER_SIZE / STRIPE_LENGTH);
+            bufferedSize = 0;
+        }
+
+        // Consume a long piece in place, up to its final 1-64 bytes, and keep its last consumed stripe at the
+        // end of the buffer, where digest() finds the bytes preceding a short remainder
+        if (static_cast<size_t>(end - input) > BUFFER_SIZE) {
+            size_t stripeCount = (end - input - 1) / STRIPE_LENGTH;
+            consumeStripes(*kernel, accumulators, stripesSoFar, input, stripeCount);
+            input += stripeCount * STRIPE_LENGTH;
+            memcpy(buffer + BUFFER_SIZE - STRIPE_LENGTH, input - STRIPE_LENGTH, STRIPE_LENGTH);
+        }
+
+        memcpy(buffer, input, end - input);
+        bufferedSize = end - input;
+    }
+
+    // Return the hash of everything given so far; the state is left unchanged, so more input may follow
+    uint64_t digest() const {
+        if (totalLength <= MIDSIZE_MAX) {
+            return hash(buffer, static_cast<size_t>(totalLength), *kernel);
+        }
+
+        alignas(32) uint64_t acc[8];
+        memcpy(acc, accumulators, sizeof(acc));
+        if (bufferedSize >= STRIPE_LENGTH) {
+            size_t stripes = stripesSoFar;
+            consumeStripes(*kernel, acc, stripes, buffer, (bufferedSize - 1) / STRIPE_LENGTH);
+            accumulateLastStripe(*kernel, acc, buffer + bufferedSize - STRIPE_LENGTH);
+        }
+        else {
+            // The last stripe starts in the previously consumed input, still at the end of the buffer
+            uint8_t lastStripe[STRIPE_LENGTH];
+            size_t catchUp = STRIPE_LENGTH - bufferedSize;
+            memcpy(lastStripe, buffer + BUFFER_SIZE - catchUp, catchUp);
+            memcpy(lastStripe + catchUp, buffer, bufferedSize);
+            accumulateLastStripe(*kernel, acc, lastStripe);
+        }
+        return mergeAccumulators(acc, totalLength);
+    }
+};
+
+constexpr size_t XXHash3::STRIPE_LENGTH;
+constexpr size_t XXHash3::SECRET_SIZE;
+constexpr size_t XXHash3::SECRET_CONSUME_RATE;
+constexpr size_t XXHash3::STRIPES_PER_BLOCK;
+constexpr size_t XXHash3::MIDSIZE_MAX;
+constexpr size_t XXHash3::BUFFER_SIZE;
+constexpr uint32_t XXHash3::PRIME32_1;
+constexpr uint32_t XXHash3::PRIME32_2;
+constexpr uint32_t XXHash3::PRIME32_3;
+constexpr uint64_t XXHash3::PRIME64_1;
+constexpr uint64_t XXHash3::PRIME64_2;
+constexpr uint64_t XXHash3::PRIME64_3;
+constexpr uint64_t XXHash3::PRIME64_4;
+constexpr uint64_t XXHash3::PRIME64_5;
+constexpr uint8_t XXHash3::SECRET[XXHash3::SECRET_SIZE];
+
+// CRC32C (Castagnoli polynomial, reflected 0x82F63B78), the checksum of the SSE4.2 crc32 instruction
+// The software kernel is table-driven, slicing 8 bytes per step. The SSE4.2 kernels feed the instruction 8
+// bytes at a time; since each crc32 has a latency of 3 cycles but a throughput of 1, the interleaved kernel
+// runs three independent streams over adjacent chunks of a long input, and then combines them by shifting
+// the earlier CRCs over the length of the later chunks with precomputed tables. The kernel is chosen once
+// at run time from what the CPU supports; all kernels give the same checksum.
+class Crc32c {
+public:
+    // Stores a kernel that advances a raw (not inverted) CRC over `length` bytes
+    struct Kernel {
+        string name;
+        uint32_t (*update)(uint32_t crc, const uint8_t* data, size_t length);
+    };
+
+private:
+    static constexpr uint32_t POLYNOMIAL = 0x82F63B78u;
+
+    // Lengths of the chunks of one interleaved round, three chunks per round: long rounds first, then short
+    static constexpr size_t LONG_CHUNK = 8192;
+    static constexpr size_t SHORT_CHUNK = 256;
+
+    // Stores the slicing-by-8 tables: entries[k][b] is the CRC of byte b followed by k zero bytes
+    struct SliceTables {
+        uint32_t entries[8][256];
+    };
+
+    // Stores the tables that shift a CRC over a fixed number of zero bytes, one table per byte of the CRC;
+    // CRCs are linear, so the shifted CRC is the xor of the four looked-up values
+    struct ShiftTables {
+        uint32_t entries[4][256];
+    };
+
+    static uint64_t read64(const uint8_t* p) {
+        uint64_t value;
+        memcpy(&value, p, 8);
+        return value;
+    }
+
+    static const SliceTables& sliceTables() {
+        static const SliceTables tables = [] {
+            SliceTables result;
+            for (uint32_t b = 0; b < 256; ++b) {
+                uint32_t crc = b;
+                for (int bit = 0; bit < 8; ++bit) {
+                    crc = (crc >> 1) ^ (POLYNOMIAL & (0u - (crc & 1)));
+                }
+                result.entries[0][b] = crc;
+            }
+            for (int k = 1; k < 8; ++k) {
+                for (uint32_t b = 0; b < 256; ++b) {
+                    uint32_t previous = result.entries[k - 1][b];
+                    result.entries[k][b] = (previous >> 8) ^ result.entries[0][previous & 0xFF];
+                }
+            }
+            return result;
+        }();
+        return tables;
+    }
+
+    // Build the tables that shift a CRC over `length` zero bytes: shift each of the 32 single-bit CRCs byte
+    // by byte, then every table entry is the xor of the shifted bits it contains
+    static ShiftTables buildShiftTables(size_t length) {
+        const SliceTables& slices = sliceTables();
+        uint32_t shiftedBits[32];
+        for (int bit = 0; bit < 32; ++bit) {
+            uint32_t crc = 1u << bit;
+            for (size_t i = 0; i < length; ++i) {
+                crc = (crc >> 8) ^ slices.entries[0][crc & 0xFF];
+            }
+            shiftedBits[bit] = crc;
+        }
+
+        ShiftTables result;
+        for (int k = 0; k < 4; ++k) {
+            for (uint32_t b = 0; b < 256; ++b) {
+                uint32_t shifted = 0;
+                for (int bit = 0; bit < 8; ++bit) {
+                    if (b & (1u << bit)) {
+                        shifted ^= shiftedBits[8 * k + bit];
+                    }
+                }
+                result.entries[k][b] = shifted;
+            }
+        }
+        return result;
+    }
+
+    static const ShiftTables& longShiftTables() {
+        static const ShiftTables tables = buildShiftTables(LONG_CHUNK);
+        return tables;
+    }
+    static const ShiftTables& shortShiftTables() {
+        static const ShiftTables tables = buildShiftTables(SHORT_CHUNK);
+        return tables;
+    }
+
+    // Shift a CRC over the zero bytes the tables were built for
+    static uint32_t shift(const ShiftTables& tables, uint32_t crc) {
+        return tables.entries[0][crc & 0xFF] ^ tables.entries[1][(crc >> 8) & 0xFF]
+            ^ tables.entries[2][(crc >> 16) & 0xFF] ^ tables.entries[3][crc >> 24];
+    }
+
+    // Software kernel, slicing by 8
+    static uint32_t updateTable(uint32_t crc, const uint8_t* data, size_t length) {
+        const SliceTables& tables = sliceTables();
+        const uint8_t* end = data + length;
+        for (; data + 8 <= end; data += 8) {
+            uint64_t word = read64(data) ^ crc;
+            crc = tables.entries[7][word & 0xFF] ^ tables.entries[6][(word >> 8) & 0xFF]
+                ^ tables.entries[5][(word >> 16) & 0xFF] ^ tables.entries[4][(word >> 24) & 0xFF]
+                ^ tables.entries[3][(word >> 32) & 0xFF] ^ tables.entries[2][(word >> 40) & 0xFF]
+                ^ tables.entries[1][(word >> 48) & 0xFF] ^ tables.entries[0][word >> 56];
+        }
+        for (; data < end; ++data) {
+            crc = (crc >> 8) ^ tables.entries[0][(crc ^ *data) & 0xFF];
+        }
+        return crc;
+    }
+
+#if defined(__x86_64__)
+    // SSE4.2 kernel, one stream; compiled for SSE4.2 whatever the build flags, and only called when the CPU
+    // reports it
+    __attribute__((target("sse4.2")))
+    static uint32_t updateHardware(uint32_t crc, const uint8_t* data, size_t length) {
+        uint64_t crc64 = crc;
+        const uint8_t* end = data + length;
+        for (; data + 8 <= end; data += 8) {
+            crc64 = _mm_crc32_u64(crc64, read64(data));
+        }
+        uint32_t crc32 = static_cast<uint32_t>(crc64);
+        for (; data < end; ++data) {
+            crc32 = _mm_crc32_u8(crc32, *data);
+        }
+        return crc32;
+    }
+
+    // Run three streams over the next three chunks of `chunk` bytes, and fold them into the running CRC
+    __attribute__((target("sse4.2")))
+    static uint32_t updateThreeChunks(uint32_t crc, const uint8_t* data, size_t chunk, const ShiftTables& tables) {
+        uint64_t crc0 = crc;
+        uint64_t crc1 = 0;
+        uint64_t crc2 = 0;
+        for (const uint8_t* end = data + chunk; data < end; data += 8) {
+            crc0 = _mm_crc32_u64(crc0, read64(data));
+            crc1 = _mm_crc32_u64(crc1, read64(data + chunk));
+            crc2 = _mm_crc32_u64(crc2, read64(data + 2 * chunk));
+        }
+        uint32_t combined = shift(tables, static_cast<uint32_t>(crc0)) ^ static_cast<uint32_t>(crc1);
+        return shift(tables, combined) ^ static_cast<uint32_t>(crc2);
+    }
+
+    // Run interleaved rounds while at least three short chunks remain, advancing data and length past them
+    // Kept out of line, so that short keys do not pay for the registers and stack frame of the rounds
+    __attribute__((target("sse4.2"), noinline))
+    static uint32_t updateInterleavedRounds(uint32_t crc, const uint8_t*& data, size_t& length) {
+        for (; length >= 3 * LONG_CHUNK; data += 3 * LONG_CHUNK, length -= 3 * LONG_CHUNK) {
+            crc = updateThreeChunks(crc, data, LONG_CHUNK, longShiftTables());
+        }
+        for (; length >= 3 * SHORT_CHUNK; data += 3 * SHORT_CHUNK, length -= 3 * SHORT_CHUNK) {
+            crc = updateThreeChunks(crc, data, SHORT_CHUNK, shortShiftTables());
+        }
+        return crc;
+    }
+
+    // SSE4.2 kernel, three interleaved streams while at least three short chunks remain, then one stream
+    __attribute__((target("sse4.2")))
+    static uint32_t updateHardwareInterleaved(uint32_t crc, const uint8_t* data, size_t length) {
+        if (length >= 3 * SHORT_CHUNK) {
+            crc = updateInterleavedRounds(crc, data, length);
+        }
+        return updateHardware(crc, data, length);
+    }
+#endif
+
+public:
+    // Return every kernel this build and CPU can run, the fastest last
+    static const vector<Kernel>& kernels() {
+        static const vector<Kernel> available = [] {
+            vector<Kernel> result = { { "table", updateTable } };
+#if defined(__x86_64__)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("sse4.2")) {
+                result.push_back({ "SSE4.2", updateHardware });
+                result.push_back({ "SSE4.2 x3", updateHardwareInterleaved });
+            }
+#endif
+            return result;
+        }();
+        return available;
+    }
+
+    // Return the kernel used unless another one is asked for
+    static const Kernel& defaultKernel() {
+        return kernels().back();
+    }
+
+    // Return the CRC32C of `length` bytes: the raw CRC starts from all ones and is inverted at the end
+    static uint32_t checksum(const void* data, size_t length, const Kernel& kernel = defaultKernel()) {
+        return ~kernel.update(~0u, static_cast<const uint8_t*>(data), length);
+    }
+};
+
+constexpr uint32_t Crc32c::POLYNOMIAL;
+constexpr size_t Crc32c::LONG_CHUNK;
+constexpr size_t Crc32c::SHORT_CHUNK;
+
+// Hash built from AES encryption rounds (one aesenc: ShiftRows, SubBytes, MixColumns, then xor with a round
+// key), in the style of ahash and Meow hash. Data enters as round keys or xored into the state, and fixed
+// keys taken from the digits of pi separate the lanes.
+// Keys of 0-16 bytes fill one block with overlapping loads from both ends, like XXH3, and get three rounds.
+// Keys of 17-64 bytes feed two lanes with the first and last 16 or 32 bytes. Longer keys feed four lanes one
+// 64-byte block at a time, one round per 16 bytes, and finish with the last 64 bytes; the lanes are then
+// merged with rounds. The length enters as the key of the first round, after the S-box, rather than xored
+// into the data, where it would cancel against the data bytes of a key of another length.
+// The algorithm is written once over a block type; the AES-NI kernel runs it on __m128i and the portable
+// kernel on bytes, with a software AES round whose S-box is computed from inverses in GF(2^8), so both give
+// the same hash. The kernel is chosen once at run time from what the CPU supports.
+class AesHash {
+public:
+    // Stores a kernel: the whole hash of `length` bytes
+    struct Kernel {
+        string name;
+        uint64_t (*hash)(const uint8_t* data, size_t length);
+    };
+
+    // Stores a 128-bit block in memory order, the layout of an SSE register
+    struct Block {
+        uint8_t bytes[16];
+    };
+
+private:
+    static constexpr uint64_t KEYS[4][2] = {
+        { 0x243F6A8885A308D3ULL, 0x13198A2E03707344ULL },
+        { 0xA4093822299F31D0ULL, 0x082EFA98EC4E6C89ULL },
+        { 0x452821E638D01377ULL, 0xBE5466CF34E90C6CULL },
+        { 0xC0AC29B7C97C50DDULL, 0x3F84D5B5B5470917ULL },
+    };
+
+    static uint64_t read64(const uint8_t* p) {
+        uint64_t value;
+        memcpy(&value, p, 8);
+        return value;
+    }
+    static uint64_t read32(const uint8_t* p) {
+        uint32_t value;
+        memcpy(&value, p, 4);
+        return value;
+    }
+
+    // Multiply by x in GF(2^8) modulo the AES polynomial x^8 + x^4 + x^3 + x + 1
+    static uint8_t timesX(uint8_t value) {
+        return static_cast<uint8_t>((value << 1) ^ ((value >> 7) * 0x1B));
+    }
+
+    // Block operations of the portable kernel
+    struct PortableOps {
+        typedef Block Type;
+
+        static Type load(const uint8_t* p) {
+            Type block;
+            memcpy(block.bytes, p, 16);
+            return block;
+        }
+        static Type make(uint64_t low, uint64_t high) {
+            Type block;
+            memcpy(block.bytes, &low, 8);
+            memcpy(block.bytes + 8, &high, 8);
+            return block;
+        }
+        static Type xorBlocks(const Type& a, const Type& b) {
+            Type result;
+            for (int i = 0; i < 16; ++i) {
+                result.bytes[i] = a.bytes[i] ^ b.bytes[i];
+            }
+            return result;
+        }
+        static Type round(const Type& state, const Type& key) {
+            return encryptRound(state, key);
+        }
+        static uint64_t fold(const Type& block) {
+            return read64(block.bytes) ^ read64(block.bytes + 8);
+        }
+    };
+
+#if defined(__x86_64__)
+    // Block operations of the AES-NI kernel
+    struct HardwareOps {
+        typedef __m128i Type;
+
+        __attribute__((target("aes")))
+        static Type load(const uint8_t* p) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        }
+        __attribute__((target("aes")))
+        static Type make(uint64_t low, uint64_t high) {
+            return _mm_set_epi64x(static_cast<long long>(high), static_cast<long long>(low));
+        }
+        __attribute__((target("aes")))
+        static Type xorBlocks(Type a, Type b) {
+            return _mm_xor_si128(a, b);
+        }
+        __attribute__((target("aes")))
+        static Type round(Type state, Type key) {
+            return _mm_aesenc_si128(state, key);
+        }
+        __attribute__((target("aes")))
+        static uint64_t fold(Type block) {
+            return static_cast<uint64_t>(_mm_cvtsi128_si64(block)) ^ static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(block, block)));
+        }
+    };
+#endif
+
+    // Return fixed key i as a block
+    template <typename Ops>
+    static typename Ops::Type key(int i) {
+        return Ops::make(KEYS[i][0], KEYS[i][1]);
+    }
+
+    // Merge two lanes: two keyed rounds each, a round that combines them, and two more rounds
+    template <typename Ops>
+    static uint64_t finish(typename Ops::Type a, typename Ops::Type b) {
+        a = Ops::round(Ops::round(a, key<Ops>(2)), key<Ops>(1));
+        b = Ops::round(Ops::round(b, key<Ops>(3)), key<Ops>(0));
+        typename Ops::Type state = Ops::round(a, b);
+        state = Ops::round(state, key<Ops>(1));
+        state = Ops::round(state, key<Ops>(2));
+        return Ops::fold(state);
+    }
+
+    // The hash itself, over the block operations of one kernel
+    template <typename Ops>
+    static uint64_t hashBlocks(const uint8_t* p, size_t length) {
+        typedef typename Ops::Type Type;
+        Type lengthKey = Ops::xorBlocks(key<Ops>(0), Ops::make(length, 0));
+
+        if (length <= 16) {
+            uint64_t low = 0;
+            uint64_t high = 0;
+            if (length >= 8) {
+                low = read64(p);
+                high = read64(p + length - 8);
+            }
+            else if (length >= 4) {
+                low = read32(p) | (read32(p + length - 4) << 32);
+            }
+            else if (length > 0) {
+                low = p[0] | (static_cast<uint64_t>(p[length >> 1]) << 8) | (static_cast<uint64_t>(p[length - 1]) << 16);
+            }
+            Type state = Ops::round(Ops::xorBlocks(Ops::make(low, high), key<Ops>(1)), lengthKey);
+            state = Ops::round(state, key<Ops>(2));
+            state = Ops::round(state, key<Ops>(3));
+            return Ops::fold(state);
+        }
+
+        if (length <= 64) {
+            Type a = Ops::round(Ops::xorBlocks(Ops::load(p), key<Ops>(1)), lengthKey);
+            Type b = Ops::xorBlocks(Ops::load(p + length - 16), key<Ops>(2));
+            if (length > 32) {
+                a = Ops::round(a, Ops::load(p + 16));
+                b = Ops::round(b, Ops::load(p + length - 32));
+            }
+            return finish<Ops>(a, b);
+        }
+
+        Type lanes[4] = { lengthKey, key<Ops>(1), key<Ops>(2), key<Ops>(3) };
+        const uint8_t* last = p + length - 64;
+        for (; p < last; p += 64) {
+            for (int i = 0; i < 4; ++i) {
+                lanes[i] = Ops::round(lanes[i], Ops::load(p + 16 * i));
+            }
+        }
+        for (int i = 0; i < 4; ++i) {
+            lanes[i] = Ops::round(lanes[i], Ops::load(last + 16 * i));
+        }
+        return finish<Ops>(Ops::round(lanes[0], lanes[2]), Ops::round(lanes[1], lanes[3]));
+    }
+
+    static uint64_t hashPortable(const uint8_t* data, size_t length) {
+        return hashBlocks<PortableOps>(data, length);
+    }
+
+#if defined(__x86_64__)
+    // flatten inlines the AES-NI block operations into the algorithm, which has no target attribute itself
+    __attribute__((target("aes"), flatten))
+    static uint64_t hashHardware(const uint8_t* data, size_t length) {
+        return hashBlocks<HardwareOps>(data, length);
+    }
+#endif
+
+public:
+    // Return the AES S-box: the inverse in GF(2^8) (0 for 0), followed by the affine transform
+    // b ^ rotl(b, 1) ^ rotl(b, 2) ^ rotl(b, 3) ^ rotl(b, 4) ^ 0x63
+    static const uint8_t* substitutionBox() {
+        static const vector<uint8_t> box = [] {
+
+            // Powers of the generator x + 1 run through every non-zero element, so the inverse of g^i is g^(255 - i)
+            uint8_t powers[255];
+            uint8_t logarithms[256] = { 0 };
+            uint8_t value = 1;
+            for (int i = 0; i < 255; ++i) {
+                powers[i] = value;
+                logarithms[value] = static_cast<uint8_t>(i);
+                value = static_cast<uint8_t>(value ^ timesX(value));
+            }
+
+            vector<uint8_t> result(256);
+            for (int b = 0; b < 256; ++b) {
+                uint8_t inverse = b == 0 ? 0 : powers[(255 - logarithms[b]) % 255];
+                uint8_t affine = inverse;
+                for (int shift = 1; shift <= 4; ++shift) {
+                    affine ^= static_cast<uint8_t>((inverse << shift) | (inverse >> (8 - shift)));
+                }
+                result[b] = affine ^ 0x63;
+            }
+            return result;
+        }();
+        return box.data();
+    }
+
+    // One AES encryption round in software, the same as the aesenc instruction
+    // Byte i of a block is row i % 4 and column i / 4 of the AES state; ShiftRows rotates row r left by r
+    static Block encryptRound(const Block& state, const Block& roundKey) {
+        const uint8_t* box = substitutionBox();
+        Block result;
+        for (int column = 0; column < 4; ++column) {
+            uint8_t a[4];
+            for (int row = 0; row < 4; ++row) {
+                a[row] = box[state.bytes[row + 4 * ((column + row) % 4)]];
+            }
+            for (int row = 0; row < 4; ++row) {
+                // MixColumns: 2 a[r] ^ 3 a[r + 1] ^ a[r + 2] ^ a[r + 3]
+                uint8_t next = a[(row + 1) % 4];
+                uint8_t mixed = timesX(a[row]) ^ timesX(next) ^ next ^ a[(row + 2) % 4] ^ a[(row + 3) % 4];
+                result.bytes[row + 4 * column] = mixed ^ roundKey.bytes[row + 4 * column];
+            }
+        }
+        return result;
+    }
+
+    // Return every kernel this build and CPU can run, the fastest last
+    static const vector<Kernel>& kernels() {
+        static const vector<Kernel> available = [] {
+            vector<Kernel> result = { { "portable", hashPortable } };
+#if defined(__x86_64__)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("aes")) {
+                result.push_back({ "AES-NI", hashHardware });
+            }
+#endif
+            return result;
+        }();
+        return available;
+    }
+
+    // Return the kernel used unless another one is asked for
+    static const Kernel& defaultKernel() {
+        return kernels().back();
+    }
+
+    // Hash `length` bytes
+    static uint64_t hash(const void* data, size_t length, const Kernel& kernel = defaultKernel()) {
+        return kernel.hash(static_cast<const uint8_t*>(data), length);
+    }
+};
+
+constexpr uint64_t AesHash::KEYS[4][2];
+
+class HashFunctionTester {
+private:
+    // Create an empty vector to store each word<string> in wordlist
+    vector<string> words;
+
+    // Define constant string that stores the relative file path to "words.txt".
+    const string DICTIONARY_PATH = "./words.txt";
+
+    // Define constant integer for histogram width
+    const int HISTOGRAM_WIDTH = 70;
+
+    // Define constant inetger for histogram width
+    const int HISTOGRAM_HEIGHT = 10;
+
+    // Define constant integer for the number of seeds evaluated per seeded hash family
+    const int SEED_COUNT = 32;
+
+    // Define constant 64-bit base seed from which every evaluation seed is derived,
+    // so that a misbehaving seed can be reproduced from the report
+    const uint64_t BASE_SEED = 0x5DEECE66DULL;
+
+    // Stores the outcome of evaluating a seeded hash family with a single seed
+    struct SeedResult {
+        uint64_t seed;
+        double chiSquare;
+        double pValue;
+    };
+
+    // Stores a 128-bit hash output as two 64-bit halves
+    struct Hash128 {
+        uint64_t low;
+        uint64_t high;
+    };
+
+    // Stores a hash function under the name used in every report, with the number of meaningful
+    // bits in its output; buckets are always taken as the output modulo the table size
+    // A hash with a 128-bit output also keeps its full output, and hashFunc returns the low half
+    // A seeded hash family also keeps its seeded form, and hashFunc runs it with the first evaluation seed
+    struct HashFunctionEntry {
+        string name;
+        function<uint64_t(const string&)> hashFunc;
+        int outputBits;
+        function<Hash128(const string&)> wideHashFunc;
+        function<uint64_t(const string&, uint64_t)> seededHashFunc;
+
+        // Whether the sparse table tests record verdicts for this hash; hashes whose outputs carry fewer random
+        // bits than their width are still reported there, but not judged
+        bool sparseGated;
+    };
+
+    // Stores the statistic and p-value of one goodness-of-fit test
+    struct TestResult {
+        double statistic;
+        double pValue;
+    };
+
+    // Stores an observed bucket count with its exact expectation and variance under a random oracle
+    struct OccupancyStatistic {
+        double observed;
+        double expected;
+        double variance;
+
+        // Largest expected count whose p-value comes from the exact Poisson tail rather than the normal one
+        static constexpr double POISSON_LIMIT = 1000.0;
+
+        double zScore() const { return variance > 0.0 ? (observed - expected) / sqrt(variance) : 0.0; }
+
+        // Two-sided p-value: twice the smaller tail of a Poisson count with the expected mean while that is below
+        // POISSON_LIMIT, where counts of rare events are Poisson and the normal tail is far too thin (one pair
+        // against 0.005 expected is z = 14 but has probability 0.005), and of the z-score beyond
+        double pValue() const {
+            if (expected >= POISSON_LIMIT) {
+                return erfc(fabs(zScore()) / sqrt(2.0));
+            }
+            return min(1.0, 2.0 * min(poissonTail(true), poissonTail(false)));
+        }
+
+        // P(X <= observed) or P(X >= observed) for X ~ Poisson(expected), summing probabilities in log space
+        // from the observed count away from the mean, where they fall off geometrically; the tail on the side of
+        // the mean is the complement of the other one
+        double poissonTail(bool lower) const {
+            double k = floor(observed + 0.5);
+            auto logProbability = [this](double count) {
+                return expected > 0.0 ? -expected + count * log(expected) - lgamma(count + 1.0)
+                                      : (count == 0.0 ? 0.0 : -INFINITY);
+            };
+            bool belowMean = k < expected;
+            double sum = 0.0;
+            if (belowMean) {
+                for (double count = k; count >= 0.0; count -= 1.0) {
+                    double term = exp(logProbability(count));
+                    sum += term;
+                    if (term < sum * 1e-17) {
+                        break;
+                    }
+                }
+            } else {
+                for (double count = k; ; count += 1.0) {
+                    double term = exp(logProbability(count));
+                    sum += term;
+                    if (term <= sum * 1e-17) {
+                        break;
+                    }
+                }
+            }
+            if (lower == belowMean) {
+                return min(1.0, sum);
+            }
+            return min(1.0, 1.0 - sum + exp(logProbability(k)));
+        }
+    };
+
+    // Stores the occupancy statistics of one histogram: empty buckets, singleton buckets and colliding pairs
+    struct OccupancyResult {
+        OccupancyStatistic empty;
+        OccupancyStatistic singletons;
+        OccupancyStatistic collidingPairs;
+    };
+
+    // Stores a histogram by its non-empty buckets only, in increasing bucket order, so that its memory follows
+    // the number of keys rather than the number of buckets
+    struct SparseHistogram {
+        uint64_t bucketCount;
+        vector<int> loads;
+    };
+
+    // Stores the entropy estimates of one histogram, in bits
+    struct EntropyEstimate {
+        double shannon;
+        double collision;
+        double minEntropy;
+    };
+
+    // Stores how often every output bit flips when a single input bit is flipped
+    struct AvalancheResult {
+        double meanFlip;
+        double worstBias;
+        int worstInputBit;
+        int worstOutputBit;
+        double chiSquare;
+        double degreesOfFreedom;
+    };
+
+    // Stores the bucket loads of one histogram: the exact maximum, and how many buckets hold exactly
+    // k keys up to LOAD_DISTRIBUTION_LIMIT, the last entry also counting every heavier bucket
+    struct LoadDistribution {
+        int maxLoad;
+        vector<uint64_t> bucketsWithLoad;
+    };
+
+    // Stores a named set of keys that hash functions are evaluated against, with its distinct keys
+    // The keys are kept as read, repeats included; up to EXACT_DISTINCT_LIMIT keys, every repeat of an earlier
+    // key is marked so that tests counting distinct keys can skip it, and distinctKeys is exact; beyond, nothing
+    // is marked and distinctKeys is the HyperLogLog estimate
+    struct Corpus {
+        string name;
+        vector<string> keys;
+        size_t distinctKeys;
+        double estimatedDistinctKeys;
+        vector<bool> repeated;
+
+        // Whether the tests count key i: every key, except one marked as a repeat of an earlier key
+        bool isCounted(size_t i) const { return repeated.empty() || !repeated[i]; }
+
+        // Number of keys the tests count
+        size_t countedKeys() const { return repeated.empty() ? keys.size() : distinctKeys; }
+    };
+
+    // Define the chi-square p-value engine shared by every test
+    ChiSquareTailEngine pValueEngine;
+
+    // Define vector of every registered hash function
+    vector<HashFunctionEntry> hashFunctions;
+
+    // Define vector of corpora used by the test matrix; the dictionary is always the first one
+    vector<Corpus> corpora;
+
+    // Define largest counter array, in bytes, counted by direct increments; beyond it the random increments mostly
+    // miss the cache and the partitioned counting engine is faster
+    // It is measured at startup by calibrateDirectCountLimit rather than derived from the cache sizes, which virtual
+    // machines often misreport, or fixed, since the crossover moves between machines
+    size_t directCountLimit;
+
+    // Stores one p-value of a report, for the multiple-testing correction at the end of the report
+    struct PValueRecord {
+        string hashName;
+        string test;
+        double pValue;
+    };
+
+    // Define vector of the p-values collected by the report in progress
+    vector<PValueRecord> reportPValues;
+
+    // Define vector of the (hash, corpus) cells the sequential screening rejected; the later passes skip them
+    vector<pair<string, string>> screenedOut;
+
+    // Define vector of the screened-out cells the report in progress skipped; each one fails its hash
+    vector<pair<string, string>> reportScreenedOut;
+
+    // Define constant family-wise error rate of the Holm correction; a Holm rejection fails a hash
+    const double HOLM_ALPHA = 0.001;
+
+    // Define constant false discovery rate of the Benjamini-Hochberg correction; a rejection makes a hash suspicious
+    const double BH_FDR = 0.05;
+
+    // Define constant vector of table sizes (bucket counts) used by the test matrix
+    const vector<size_t> MATRIX_TABLE_SIZES = { 1024, 4096, 16384, 65536 };
+
+    // Define constant number of keys hashed by a single matrix task
+    const size_t MATRIX_CHUNK_SIZE = 16384;
+
+    // Define constant number of keys in the generated "Sequential IDs" corpus
+    const size_t SEQUENTIAL_ID_COUNT = 500000;
+
+    // Define constant number of passes over the key set made by every throughput benchmark
+    const int BENCHMARK_REPETITIONS = 20;
+
+    // Define constant number of buckets the chi-square kernel sums per block
+    static constexpr size_t CHI_SQUARE_BLOCK = 4096;
+
+    // Define constant number of bootstrap replicates drawn from every corpus
+    const int BOOTSTRAP_REPLICATES = 64;
+
+    // Define constant number of bootstrap replicates evaluated by one pool task, which reuses its counters
+    const int BOOTSTRAP_REPLICATES_PER_TASK = 4;
+
+    // Define constant confidence level of the bootstrap intervals
+    const double BOOTSTRAP_CONFIDENCE = 0.95;
+
+    // Define constant number of disjoint corpus slices tested separately by the two-level test
+    const size_t TWO_LEVEL_SLICES = 100;
+
+    // Define constant number of buckets of every slice histogram in the two-level test
+    const size_t TWO_LEVEL_BUCKETS = 256;
+
+    // Define constant bucket counts of the large-table test; the ones up to compactTableLimit() are counted densely
+    // in compact counters, the larger ones only through sorted sparse histograms
+    const vector<uint64_t> SPARSE_TABLE_SIZES = { 1ULL << 16, 1ULL << 24, 1ULL << 28, 1ULL << 32, 1ULL << 40 };
+
+    // Define constant largest bucket count that the large-table test also counts in int counters, as a check
+    const uint64_t INT_CHECK_LIMIT = 1ULL << 26;
+
+    // Define constant log2 of the smallest number of buckets covered by one partition of the counting engine;
+    // the counters of one partition (64 KiB of int) stay in L2
+    static constexpr int PARTITION_SPAN_BITS = 14;
+
+    // Define constant largest number of partitions; more partitions would spread the scatter over more
+    // pages than the TLB covers, so larger tables get wider partitions instead
+    static constexpr size_t MAX_PARTITIONS = 1024;
+
+    // Define constant number of bucket indices a write-combining buffer holds: one 64-byte cache line
+    static constexpr size_t COMBINE_SLOTS = 16;
+
+    // Define constant width in bits of every radix-sort digit
+    static constexpr int RADIX_BITS = 16;
+
+    // Define constant largest corpus whose repeated keys are marked exactly; larger ones get a HyperLogLog estimate
+    const size_t EXACT_DISTINCT_LIMIT = size_t(1) << 22;
+
+    // Define constant number of random keys whose every input bit is flipped by the avalanche test
+    const int AVALANCHE_KEYS = 4096;
+
+    // Define constant vector of key lengths, in bytes, tested by the avalanche test
+    const vector<size_t> AVALANCHE_KEY_LENGTHS = { 4, 16, 64 };
+
+    // Define constant vector of key sizes, in bytes, at which cycles per byte are measured
+    const vector<size_t> CYCLE_KEY_SIZES = { 8, 16, 32, 64, 128, 240, 1024, 4096 };
+
+    // Define constant number of key bytes hashed by one pass of the cycles-per-byte benchmark
+    const size_t CYCLE_BENCHMARK_BYTES = size_t(1) << 20;
+
+    // Define constant number of passes of the cycles-per-byte benchmark; the fastest one is reported
+    const int CYCLE_BENCHMARK_PASSES = 3;
+
+    // Define constant longest key on which the XXH3 kernels and streaming API are checked at start-up
+    const size_t XXH3_CHECK_LENGTH = 4096;
+
+    // Define constant width in bits of the output windows whose entropy is estimated
+    const int ENTROPY_WINDOW_BITS = 8;
+
+    // Define constant number of loads a load distribution counts exactly; heavier buckets share its last entry
+    static constexpr int LOAD_DISTRIBUTION_LIMIT = 64;
+
+    // Define constant number of keys between two checkpoints of the sequential chi-square test
+    const size_t SEQUENTIAL_CHECKPOINT_INTERVAL = 4096;
+
+    // Define constant confidence at which the sequential chi-square test rejects a hash early
+    const double SEQUENTIAL_CONFIDENCE = 0.999;
+
+    // Define constant vector of the powers of 31 modulo 65413 used by the unrolled Remainder kernels
+    const vector<uint64_t> REMAINDER_POWERS = computeRemainderPowers();
+
+    // Helper function to convert signed char to unsigned
+    uint16_t sanitizeChar(char c) {
+        return static_cast<uint16_t>(static_cast<unsigned char>(c));
+    }
+
+   // Compute chi-square statistic for a given set of hashes
+    double computeChiSquare(const vector<int>& hashes) {
+
+        // Every distinct word of the dictionary was hashed
+        return computeChiSquare(hashes, corpora[0].countedKeys());
+    }
+
+    // Compute chi-square statistic for totalKeys keys spread over hashes.size() buckets
+    double computeChiSquare(const vector<int>& hashes, size_t totalKeys) {
+        return computeChiSquare(hashes.data(), hashes.size(), totalKeys);
+    }
+
+    // Stores the exact sum of the counts and of the squared counts of a histogram
+    struct CountSums {
+        unsigned __int128 sum;
+        unsigned __int128 sumOfSquares;
+    };
+
+    // OR together a run of counts; the result is below 2^16 only if every count is
+    template <typename Count>
+    static uint64_t orCounts(const Count* block, size_t length) {
+        uint64_t bits = 0;
+        for (size_t i = 0; i < length; ++i) {
+            bits |= static_cast<uint64_t>(block[i]);
+        }
+        return bits;
+    }
+
+    // Sum a run of counts below 2^16 and their squares; the squares stay below 2^32,
+    // so a whole block sums exactly in 64-bit lanes
+    template <typename Count>
+    static void sumSmallCounts(const Count* block, size_t length, uint64_t& sum, uint64_t& sumOfSquares) {
+        for (size_t i = 0; i < length; ++i) {
+            uint64_t count = static_cast<uint64_t>(block[i]);
+            sum += count;
+            sumOfSquares += count * count;
+        }
+    }
+
+    // Sum counts[0 .. bucketCount) and their squares in integer arithmetic
+    // The sums are exact, so the result does not depend on how the buckets are split between threads
+    template <typename Count>
+    CountSums sumCounts(const Count* counts, size_t bucketCount) {
+        CountSums sums = { 0, 0 };
+        for (size_t begin = 0; begin < bucketCount; begin += CHI_SQUARE_BLOCK) {
+            size_t end = min(begin + CHI_SQUARE_BLOCK, bucketCount);
+
+            // Full blocks pass the constant CHI_SQUARE_BLOCK as length, so the inlined loops have a fixed
+            // trip count and the compiler vectorizes them
+            bool fullBlock = end - begin == CHI_SQUARE_BLOCK;
+
+            // Check that every count of the block is below 2^16 (always true for 8 and 16-bit counters)
+            uint64_t bits = 0;
+            if (sizeof(Count) > 2) {
+                bits = fullBlock ? orCounts(counts + begin, CHI_SQUARE_BLOCK) : orCounts(counts + begin, end - begin);
+            }
+
+            if (bits < 65536) {
+                uint64_t sum = 0;
+                uint64_t sumOfSquares = 0;
+                if (fullBlock) {
+                    sumSmallCounts(counts + begin, CHI_SQUARE_BLOCK, sum, sumOfSquares);
+                }
+                else {
+                    sumSmallCounts(counts + begin, end - begin, sum, sumOfSquares);
+                }
+                sums.sum += sum;
+                sums.sumOfSquares += sumOfSquares;
+            }
+            else {
+                // Rare heavy block: accumulate in 128 bits
+                for (size_t i = begin; i < end; ++i) {
+                    unsigned __int128 count = static_cast<uint64_t>(counts[i]);
+                    sums.sum += count;
+                    sums.sumOfSquares += count * count;
+                }
+            }
+        }
+        return sums;
+    }
+
+    // Turn the exact sums of a histogram into its chi-square statistic
+    // With e = N / B, sum((c - e)^2 / e) = (B * sum(c^2) - 2 * N * sum(c) + N^2) / N. The numerator is an
+    // exact integer, so the only rounding is the final division, whatever the bucket count or thread count.
+    // No keys means no deviation at all; callers skip such cells rather than record a p-value for them
+    static double chiSquareFromSums(const CountSums& sums, uint64_t bucketCount, uint64_t totalKeys) {
+        if (totalKeys == 0) {
+            return 0.0;
+        }
+        __int128 keys = totalKeys;
+        __int128 numerator = static_cast<__int128>(bucketCount) * static_cast<__int128>(sums.sumOfSquares)
+            - 2 * keys * static_cast<__int128>(sums.sum) + keys * keys;
+        return static_cast<double>(numerator) / static_cast<double>(totalKeys);
+    }
+
+    // Compute chi-square statistic for totalKeys keys spread over bucketCount buckets of any counter width
+    // The counts are summed on the calling thread, which suits sweeps: they evaluate many histograms at once, one
+    // per pool task. A single huge histogram may pass an otherwise idle pool instead, whose workers then sum one
+    // contiguous, block-aligned range each; wait() waits for every task of the pool, so it must not be busy.
+    template <typename Count>
+    double computeChiSquare(const Count* counts, size_t bucketCount, uint64_t totalKeys, WorkStealingPool* pool = nullptr) {
+        size_t rangeCount = pool == nullptr ? 1 : max<size_t>(1, min(pool->size(), bucketCount / CHI_SQUARE_BLOCK));
+        if (rangeCount == 1) {
+            return chiSquareFromSums(sumCounts(counts, bucketCount), bucketCount, totalKeys);
+        }
+
+        size_t blocksPerRange = (bucketCount / CHI_SQUARE_BLOCK + rangeCount - 1) / rangeCount;
+        size_t rangeSize = blocksPerRange * CHI_SQUARE_BLOCK;
+        vector<CountSums> partial(rangeCount, CountSums{ 0, 0 });
+        for (size_t r = 0; r < rangeCount; ++r) {
+            pool->submit([&, r]() {
+                size_t begin = min(r * rangeSize, bucketCount);
+                size_t end = min(begin + rangeSize, bucketCount);
+                partial[r] = sumCounts(counts + begin, end - begin);
+            });
+        }
+        pool->wait();
+
+        CountSums sums = { 0, 0 };
+        for (const auto& range : partial) {
+            sums.sum += range.sum;
+            sums.sumOfSquares += range.sumOfSquares;
+        }
+        return chiSquareFromSums(sums, bucketCount, totalKeys);
+    }
+
+    // Sort values below 2^significantBits with a least-significant-digit radix sort, RADIX_BITS bits per pass
+    // Each pass is a stable counting scatter into a scratch array of the same size, so memory stays at
+    // two words per value whatever the value range
+    static void radixSort(vector<uint64_t>& values, int significantBits) {
+        vector<uint64_t> scratch(values.size());
+        vector<size_t> offsets(size_t(1) << RADIX_BITS);
+        const uint64_t mask = (1ULL << RADIX_BITS) - 1;
+        for (int shift = 0; shift < significantBits; shift += RADIX_BITS) {
+            fill(offsets.begin(), offsets.end(), 0);
+            for (uint64_t value : values) {
+                offsets[(value >> shift) & mask]++;
+            }
+            size_t running = 0;
+            for (auto& offset : offsets) {
+                size_t count = offset;
+                offset = running;
+                running += count;
+            }
+            for (uint64_t value : values) {
+                scratch[offsets[(value >> shift) & mask]++] = value;
+            }
+            values.swap(scratch);
+        }
+    }
+
+    // Add one key to a bucket of either counter array
+    static void incrementCounter(vector<int>& counts, size_t bucket) {
+        counts[bucket]++;
+    }
+    static void incrementCounter(CompactCounterArray& counts, size_t bucket) {
+        counts.increment(bucket);
+    }
+
+    // Return the size in bytes of either counter array
+    static size_t counterBytes(const vector<int>& counts) {
+        return counts.size() * sizeof(int);
+    }
+    static size_t counterBytes(const CompactCounterArray& counts) {
+        return counts.size();
+    }
+
+    // Return the address of a counter of either counter array, for prefetching
+    static const void* counterAddress(const vector<int>& counts, size_t bucket) {
+        return &counts[bucket];
+    }
+    static const void* counterAddress(const CompactCounterArray& counts, size_t bucket) {
+        return counts.data() + bucket;
+    }
+
+    // Count buckets[0 .. count) into counts, which holds one counter per bucket, by direct increments
+    template <typename Counters>
+    static void directCount(const uint32_t* buckets, size_t count, Counters& counts) {
+        for (size_t i = 0; i < count; ++i) {
+            incrementCounter(counts, buckets[i]);
+        }
+    }
+
+    // Count buckets[0 .. count) into counts in two phases, so that every increment hits the cache
+    // The buckets are first scattered by their high bits into one run per partition, through a cache-line
+    // buffer per partition that is written out whole, with non-temporal stores so that the cold destination
+    // lines are not read first; then each partition's buckets are counted while its slice of the counters
+    // stays in cache, and the next slice is prefetched meanwhile
+    template <typename Counters>
+    static void partitionedCount(const uint32_t* buckets, size_t count, Counters& counts) {
+        int shift = PARTITION_SPAN_BITS;
+        while (((counts.size() - 1) >> shift) + 1 > MAX_PARTITIONS) {
+            ++shift;
+        }
+        size_t partitions = ((counts.size() - 1) >> shift) + 1;
+
+        // Size every partition's run, and start every run on a cache-line boundary
+        vector<size_t> sizes(partitions, 0);
+        for (size_t i = 0; i < count; ++i) {
+            sizes[buckets[i] >> shift]++;
+        }
+        vector<size_t> starts(partitions + 1, 0);
+        for (size_t p = 0; p < partitions; ++p) {
+            starts[p + 1] = starts[p] + (sizes[p] + COMBINE_SLOTS - 1) / COMBINE_SLOTS * COMBINE_SLOTS;
+        }
+        vector<size_t> next(starts.begin(), starts.end() - 1);
+
+        // Scatter through the write-combining buffers; both arrays are over-allocated by a line so that
+        // they can be aligned to one
+        vector<uint32_t> scatteredStorage(starts[partitions] + COMBINE_SLOTS);
+        vector<uint32_t> combineStorage((partitions + 1) * COMBINE_SLOTS);
+        uint32_t* scattered = alignToCacheLine(scatteredStorage.data());
+        uint32_t* combine = alignToCacheLine(combineStorage.data());
+        vector<uint32_t> filled(partitions, 0);
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t bucket = buckets[i];
+            size_t p = bucket >> shift;
+            uint32_t* line = combine + p * COMBINE_SLOTS;
+            line[filled[p]++] = bucket;
+            if (filled[p] == COMBINE_SLOTS) {
+                streamCacheLine(scattered + next[p], line);
+                next[p] += COMBINE_SLOTS;
+                filled[p] = 0;
+            }
+        }
+#ifdef __SSE2__
+        _mm_sfence();
+#endif
+        for (size_t p = 0; p < partitions; ++p) {
+            memcpy(scattered + next[p], combine + p * COMBINE_SLOTS, sizeof(uint32_t) * filled[p]);
+        }
+
+        // Count partition by partition
+        size_t span = size_t(1) << shift;
+        for (size_t p = 0; p < partitions; ++p) {
+            for (size_t j = (p + 1) * span; j < min((p + 2) * span, counts.size()); j += COMBINE_SLOTS) {
+                __builtin_prefetch(counterAddress(counts, j), 1);
+            }
+            for (size_t i = starts[p]; i < starts[p] + sizes[p]; ++i) {
+                incrementCounter(counts, scattered[i]);
+            }
+        }
+    }
+
+    // Round a pointer into an over-allocated array up to the next 64-byte cache line
+    static uint32_t* alignToCacheLine(uint32_t* pointer) {
+        return reinterpret_cast<uint32_t*>((reinterpret_cast<uintptr_t>(pointer) + 63) & ~uintptr_t(63));
+    }
+
+    // Copy one full cache line of bucket indices to an aligned destination, bypassing the cache when SSE2
+    // non-temporal stores are available
+    static void streamCacheLine(uint32_t* destination, const uint32_t* line) {
+#ifdef __SSE2__
+        __m128i* target = reinterpret_cast<__m128i*>(destination);
+        const __m128i* source = reinterpret_cast<const __m128i*>(line);
+        for (int k = 0; k < 4; ++k) {
+            _mm_stream_si128(target + k, _mm_load_si128(source + k));
+        }
+#else
+        memcpy(destination, line, sizeof(uint32_t) * COMBINE_SLOTS);
+#endif
+    }
+
+    // Count buckets[0 .. count) into counts, picking the engine by the size of the counter array
+    template <typename Counters>
+    void countBuckets(const uint32_t* buckets, size_t count, Counters& counts) const {
+        if (counterBytes(counts) <= directCountLimit) {
+            directCount(buckets, count, counts);
+        } else {
+            partitionedCount(buckets, count, counts);
+        }
+    }
+
+    // Measure the largest int counter array that direct increments count at least as fast as the partitioned
+    // engine: the table grows by factors of 4 from 2^16 buckets until direct increments lose, timing each engine
+    // over 5 runs of 2^22 random buckets like the benchmark; one partition's counters, which the partitioned engine
+    // cannot split, are the floor. Returns the size in bytes; it takes about a second
+    size_t calibrateDirectCountLimit() const {
+        const size_t keyCount = size_t(1) << 22;
+        vector<uint64_t> values(keyCount);
+        uint64_t state = BASE_SEED;
+        for (auto& value : values) {
+            value = splitMix64(state);
+        }
+
+        // Total time of 5 runs of one engine, in seconds; the counters are cleared outside the timed region
+        auto measure = [keyCount](auto engine, const vector<uint32_t>& buckets, vector<int>& counts) {
+            double seconds = 0.0;
+            for (int run = 0; run < 5; ++run) {
+                fill(counts.begin(), counts.end(), 0);
+                auto start = chrono::steady_clock::now();
+                engine(buckets.data(), keyCount, counts);
+                seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            }
+            return seconds;
+        };
+
+        size_t limit = (size_t(1) << PARTITION_SPAN_BITS) * sizeof(int);
+        for (int bits = 16; bits <= 26; bits += 2) {
+            size_t bucketCount = size_t(1) << bits;
+            vector<uint32_t> buckets(keyCount);
+            for (size_t i = 0; i < keyCount; ++i) {
+                buckets[i] = static_cast<uint32_t>(values[i] & (bucketCount - 1));
+            }
+            vector<int> counts(bucketCount);
+            double direct = measure(directCount<vector<int>>, buckets, counts);
+            double partitioned = measure(partitionedCount<vector<int>>, buckets, counts);
+            if (direct > partitioned) {
+                break;
+            }
+            limit = bucketCount * sizeof(int);
+        }
+        return limit;
+    }
+
+    // Return the largest bucket count counted densely in compact counters: one byte per bucket may take up to a
+    // quarter of the physical memory, so a 2^32-bucket table needs 16 GiB; bucket indices must also fit in 32 bits
+    static uint64_t compactTableLimit() {
+        uint64_t memory = 0;
+#if defined(_SC_PHYS_PAGES) && defined(_SC_PAGE_SIZE)
+        long pages = sysconf(_SC_PHYS_PAGES);
+        long pageSize = sysconf(_SC_PAGE_SIZE);
+        if (pages > 0 && pageSize > 0) {
+            memory = static_cast<uint64_t>(pages) * static_cast<uint64_t>(pageSize);
+        }
+#endif
+        if (memory == 0) {
+            return 1ULL << 26;
+        }
+        return min<uint64_t>(memory / 4, 1ULL << 32);
+    }
+
+    // Build a sparse histogram from the bucket of every key: sort the buckets, then every run of equal
+    // buckets is one non-empty bucket whose load is the run length
+    static SparseHistogram buildSparseHistogram(vector<uint64_t> buckets, uint64_t bucketCount) {
+        int significantBits = 0;
+        while (significantBits < 64 && (bucketCount - 1) >> significantBits != 0) {
+            ++significantBits;
+        }
+        radixSort(buckets, significantBits);
+
+        SparseHistogram histogram = { bucketCount, {} };
+        for (size_t begin = 0; begin < buckets.size();) {
+            size_t end = begin + 1;
+            while (end < buckets.size() && buckets[end] == buckets[begin]) {
+                ++end;
+            }
+            histogram.loads.push_back(static_cast<int>(end - begin));
+            begin = end;
+        }
+        return histogram;
+    }
+
+    // Compute the chi-square statistic of a sparse histogram; empty buckets add nothing to either sum, so the
+    // exact formula of the dense kernel applies to the non-empty loads with the full bucket count
+    double computeChiSquare(const SparseHistogram& histogram, uint64_t totalKeys) {
+        return chiSquareFromSums(sumCounts(histogram.loads.data(), histogram.loads.size()), histogram.bucketCount, totalKeys);
+    }
+
+    // Compute the chi-square statistic of compact counters: the byte counters go through the vectorized
+    // kernel's sums, then every spilled bucket replaces its saturated 255 by its exact load
+    double computeChiSquare(const CompactCounterArray& counts, uint64_t totalKeys) {
+        CountSums sums = sumCounts(counts.data(), counts.size());
+        for (const auto& spilled : counts.spilled()) {
+            unsigned __int128 load = CompactCounterArray::SATURATED + spilled.second;
+            sums.sum += spilled.second;
+            sums.sumOfSquares += load * load - CompactCounterArray::SATURATED * CompactCounterArray::SATURATED;
+        }
+        return chiSquareFromSums(sums, counts.size(), totalKeys);
+    }
+
+    // Advance a SplitMix64 state and return the next 64-bit pseudo-random value
+    static uint64_t splitMix64(uint64_t& state) {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // Generate the list of seeds used to evaluate seeded hash families
+    vector<uint64_t> generateSeeds(int count) {
+
+        // Start the generator from the fixed base seed so every run evaluates the same seeds
+        uint64_t state = BASE_SEED;
+
+        // Draw one 64-bit seed per evaluation
+        vector<uint64_t> seeds(count);
+        for (auto& seed : seeds) {
+            seed = splitMix64(state);
+        }
+        return seeds;
+    }
+
+    // Return the value at the given fraction (0.0 to 1.0) of an already sorted vector
+    static double percentile(const vector<double>& sorted, double fraction) {
+        size_t index = static_cast<size_t>(round(fraction * (sorted.size() - 1)));
+        return sorted[index];
+    }
+
+    // Remainder hash of `count` keys, advancing LANES keys in lockstep
+    // Every lane runs its own h = (h * 31 + c) % 65413 chain; the chains are independent, so
+    // the CPU overlaps their multiplies and divides instead of waiting on a single chain.
+    // A group runs in lockstep over its shortest key, then each lane finishes its own tail.
+    template <int LANES>
+    void remainderHashBatch(const string* keys, size_t count, uint16_t* out) {
+        const uint32_t m = 65413;  // Define modulus value
+
+        // Full groups of LANES keys
+        size_t base = 0;
+        for (; base + LANES <= count; base += LANES) {
+
+            // Load the lanes and find the length every key of the group shares
+            uint32_t h[LANES];
+            const char* data[LANES];
+            size_t sharedLength = keys[base].size();
+            for (int lane = 0; lane < LANES; ++lane) {
+                h[lane] = 0;
+                data[lane] = keys[base + lane].data();
+                sharedLength = min(sharedLength, keys[base + lane].size());
+            }
+
+            // Advance all lanes by one character per step
+            for (size_t i = 0; i < sharedLength; ++i) {
+                for (int lane = 0; lane < LANES; ++lane) {
+                    h[lane] = (h[lane] * 31 + sanitizeChar(data[lane][i])) % m;
+                }
+            }
+
+            // Finish the remaining characters of every lane and store the result
+            for (int lane = 0; lane < LANES; ++lane) {
+                for (size_t i = sharedLength; i < keys[base + lane].size(); ++i) {
+                    h[lane] = (h[lane] * 31 + sanitizeChar(data[lane][i])) % m;
+                }
+                out[base + lane] = static_cast<uint16_t>(h[lane]);
+            }
+        }
+
+        // Keys left over after the last full group are hashed one at a time
+        for (; base < count; ++base) {
+            uint32_t h = 0;
+            for (char c : keys[base]) {
+                h = (h * 31 + sanitizeChar(c)) % m;
+            }
+            out[base] = static_cast<uint16_t>(h);
+        }
+    }
+
+    // Multiplicative hash of `count` keys, advancing LANES keys in lockstep
+    // Same grouping as remainderHashBatch. fmod(x, 1.0) is replaced by x - trunc(x), which is exact
+    // (and so bit-identical) for the non-negative values that occur here and avoids a libm call per step
+    template <int LANES>
+    void multiplicativeHashBatch(const string* keys, size_t count, uint16_t* out) {
+
+        // Full groups of LANES keys
+        size_t base = 0;
+        for (; base + LANES <= count; base += LANES) {
+
+            // Load the lanes and find the length every key of the group shares
+            double h[LANES];
+            const char* data[LANES];
+            size_t sharedLength = keys[base].size();
+            for (int lane = 0; lane < LANES; ++lane) {
+                h[lane] = 0.0;
+                data[lane] = keys[base + lane].data();
+                sharedLength = min(sharedLength, keys[base + lane].size());
+            }
+
+            // Advance all lanes by one character per step
+            for (size_t i = 0; i < sharedLength; ++i) {
+                for (int lane = 0; lane < LANES; ++lane) {
+                    double x = h[lane] * 0.6180339887 + sanitizeChar(data[lane][i]);
+                    h[lane] = x - trunc(x);
+                }
+            }
+
+            // Finish the remaining characters of every lane and store the scaled result
+            for (int lane = 0; lane < LANES; ++lane) {
+                for (size_t i = sharedLength; i < keys[base + lane].size(); ++i) {
+                    double x = h[lane] * 0.6180339887 + sanitizeChar(data[lane][i]);
+                    h[lane] = x - trunc(x);
+                }
+                out[base + lane] = static_cast<uint16_t>(h[lane] * 65536);
+            }
+        }
+
+        // Keys left over after the last full group are hashed one at a time
+        for (; base < count; ++base) {
+            double h = 0.0;
+            for (char c : keys[base]) {
+                double x = h * 0.6180339887 + sanitizeChar(c);
+                h = x - trunc(x);
+            }
+            out[base] = static_cast<uint16_t>(h * 65536);
+        }
+    }
+
+    // Compute 31^0 .. 31^8 modulo 65413, the factors that fold several characters into one Remainder step
+    static vector<uint64_t> computeRemainderPowers() {
+        vector<uint64_t> powers(9, 1);
+        for (size_t i = 1; i < powers.size(); ++i) {
+            powers[i] = powers[i - 1] * 31 % 65413;
+        }
+        return powers;
+    }
+
+    // Remainder hash that folds 4 characters per step:
+    // h' = (h * 31^4 + c0 * 31^3 + c1 * 31^2 + c2 * 31 + c3) mod 65413, which is Horner's rule regrouped,
+    // so the output is bit-identical. The character terms do not depend on h and run in parallel,
+    // leaving one multiply and one reduction per 4 characters on the dependency chain.
+    uint16_t remainderHashUnrolled4(const string& word) {
+        const uint64_t m = 65413;  // Define modulus value
+        const vector<uint64_t>& p = REMAINDER_POWERS;
+        const char* data = word.data();
+        size_t length = word.size();
+
+        uint64_t h = 0;
+        size_t i = 0;
+        for (; i + 4 <= length; i += 4) {
+            uint64_t block = sanitizeChar(data[i]) * p[3] + sanitizeChar(data[i + 1]) * p[2]
+                + sanitizeChar(data[i + 2]) * p[1] + sanitizeChar(data[i + 3]);
+            h = (h * p[4] + block) % m;
+        }
+
+        // Remaining 0-3 characters, one at a time
+        for (; i < length; ++i) {
+            h = (h * 31 + sanitizeChar(data[i])) % m;
+        }
+        return static_cast<uint16_t>(h);
+    }
+
+    // Remainder hash that folds 8 characters per step, like remainderHashUnrolled4
+    // h * 31^8 < 2^32 and the eight character terms add less than 2^27, so the sum fits easily in 64 bits
+    uint16_t remainderHashUnrolled8(const string& word) {
+        const uint64_t m = 65413;  // Define modulus value
+        const vector<uint64_t>& p = REMAINDER_POWERS;
+        const char* data = word.data();
+        size_t length = word.size();
+
+        uint64_t h = 0;
+        size_t i = 0;
+        for (; i + 8 <= length; i += 8) {
+            uint64_t high = sanitizeChar(data[i]) * p[7] + sanitizeChar(data[i + 1]) * p[6]
+                + sanitizeChar(data[i + 2]) * p[5] + sanitizeChar(data[i + 3]) * p[4];
+            uint64_t low = sanitizeChar(data[i + 4]) * p[3] + sanitizeChar(data[i + 5]) * p[2]
+                + sanitizeChar(data[i + 6]) * p[1] + sanitizeChar(data[i + 7]);
+            h = (h * p[8] + high + low) % m;
+        }
+
+        // Remaining 0-7 characters, one at a time
+        for (; i < length; ++i) {
+            h = (h * 31 + sanitizeChar(data[i])) % m;
+        }
+        return static_cast<uint16_t>(h);
+    }
+
+    // Remainder hash with a 64-bit accumulator and lazy reduction
+    // Starting below 65413, eight steps of h * 31 + c stay below 2^16 * 31^8 * 1.04 < 2^56,
+    // so the reduction is only needed once every 8 characters and once at the end
+    uint16_t remainderHashLazy64(const string& word) {
+        const uint64_t m = 65413;  // Define modulus value
+        const char* data = word.data();
+        size_t length = word.size();
+
+        uint64_t h = 0;
+        size_t i = 0;
+        for (; i + 8 <= length; i += 8) {
+            for (size_t j = 0; j < 8; ++j) {
+                h = h * 31 + sanitizeChar(data[i + j]);
+            }
+            h %= m;
+        }
+
+        // Remaining 0-7 characters, reduced once at the end
+        for (; i < length; ++i) {
+            h = h * 31 + sanitizeChar(data[i]);
+        }
+        return static_cast<uint16_t>(h % m);
+    }
+
+    // FNV-1a, 32-bit: for every byte, xor it into the state, then multiply by the FNV prime
+    static uint32_t fnv1a32(const string& word) {
+        const uint32_t offsetBasis = 0x811C9DC5u;  // Define the 32-bit FNV offset basis
+        const uint32_t prime = 0x01000193u;  // Define the 32-bit FNV prime, 2^24 + 2^8 + 0x93
+        uint32_t h = offsetBasis;
+        for (char c : word) {
+            h = (h ^ static_cast<unsigned char>(c)) * prime;
+        }
+        return h;
+    }
+
+    // FNV-1a, 64-bit: the same byte loop with the 64-bit offset basis and prime
+    static uint64_t fnv1a64(const string& word) {
+        const uint64_t offsetBasis = 0xCBF29CE484222325ULL;  // Define the 64-bit FNV offset basis
+        const uint64_t prime = 0x00000100000001B3ULL;  // Define the 64-bit FNV prime, 2^40 + 2^8 + 0xB3
+        uint64_t h = offsetBasis;
+        for (char c : word) {
+            h = (h ^ static_cast<unsigned char>(c)) * prime;
+        }
+        return h;
+    }
+
+    // FNV-1a style hash that consumes 8 bytes per step instead of one
+    // Each step xors a whole little-endian word into the state and multiplies by the 64-bit FNV prime, so
+    // the dependency chain is one multiply per 8 bytes. The last 1-7 bytes are copied into a zeroed word,
+    // and the length is mixed in so that trailing zero bytes still change the hash. A multiply only carries
+    // bits upwards, so high input bits would never reach the low bits that pick a bucket; a final
+    // xor-shift-multiply avalanche folds them down. The output is therefore not FNV-1a 64.
+    static uint64_t fnv1a64WordAtATime(const string& word) {
+        const uint64_t offsetBasis = 0xCBF29CE484222325ULL;  // Define the 64-bit FNV offset basis
+        const uint64_t prime = 0x00000100000001B3ULL;  // Define the 64-bit FNV prime
+        const char* data = word.data();
+        size_t length = word.size();
+
+        uint64_t h = offsetBasis;
+        size_t i = 0;
+        for (; i + 8 <= length; i += 8) {
+            uint64_t block;
+            memcpy(&block, data + i, 8);  // Unaligned-safe load of the next 8 bytes
+            h = (h ^ block) * prime;
+        }
+
+        // Remaining 0-7 bytes, zero-padded to a full word, followed by the length
+        uint64_t tail = 0;
+        memcpy(&tail, data + i, length - i);
+        h = (h ^ tail) * prime;
+        h = (h ^ length) * prime;
+
+        // Final avalanche, the MurmurHash3 64-bit finalizer
+        return murmurFinalize64(h);
+    }
+
+    // Rotate a 32-bit or 64-bit value left by r bits, 0 < r < width
+    static uint32_t rotateLeft32(uint32_t x, int r) {
+        return (x << r) | (x >> (32 - r));
+    }
+    static uint64_t rotateLeft64(uint64_t x, int r) {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    // MurmurHash3 finalizers: every input bit affects every output bit
+    static uint32_t murmurFinalize32(uint32_t h) {
+        h ^= h >> 16;
+        h *= 0x85EBCA6Bu;
+        h ^= h >> 13;
+        h *= 0xC2B2AE35u;
+        h ^= h >> 16;
+        return h;
+    }
+    static uint64_t murmurFinalize64(uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // MurmurHash3 x86_32, 4-byte blocks
+    // Blocks are read with memcpy, which is safe at any alignment and compiles to a plain load. The 0-3 tail
+    // bytes are copied into a zeroed block and always mixed in: a zero block mixes to zero, so this matches
+    // the reference's switch on the tail length without branching on it.
+    static uint32_t murmur3x86_32(const string& key, uint32_t seed = 0) {
+        const uint32_t c1 = 0xCC9E2D51u;  // Define the first block multiplier
+        const uint32_t c2 = 0x1B873593u;  // Define the second block multiplier
+        const char* data = key.data();
+        size_t length = key.size();
+
+        uint32_t h = seed;
+        size_t i = 0;
+        for (; i + 4 <= length; i += 4) {
+            uint32_t k;
+            memcpy(&k, data + i, 4);
+            k = rotateLeft32(k * c1, 15) * c2;
+            h = rotateLeft32(h ^ k, 13) * 5 + 0xE6546B64u;
+        }
+
+        uint32_t k = 0;
+        memcpy(&k, data + i, length - i);
+        h ^= rotateLeft32(k * c1, 15) * c2;
+
+        return murmurFinalize32(h ^ static_cast<uint32_t>(length));
+    }
+
+    // MurmurHash3 x64_128, 16-byte blocks in two 64-bit lanes
+    // The tail is handled like in murmur3x86_32: up to 15 bytes are copied into a zeroed block of two lanes,
+    // and both lanes are mixed in unconditionally
+    static Hash128 murmur3x64_128(const string& key, uint64_t seed = 0) {
+        const uint64_t c1 = 0x87C37B91114253D5ULL;  // Define the first lane multiplier
+        const uint64_t c2 = 0x4CF5AD432745937FULL;  // Define the second lane multiplier
+        const char* data = key.data();
+        size_t length = key.size();
+
+        uint64_t h1 = seed;
+        uint64_t h2 = seed;
+        size_t i = 0;
+        for (; i + 16 <= length; i += 16) {
+            uint64_t k1, k2;
+            memcpy(&k1, data + i, 8);
+            memcpy(&k2, data + i + 8, 8);
+
+            h1 ^= rotateLeft64(k1 * c1, 31) * c2;
+            h1 = (rotateLeft64(h1, 27) + h2) * 5 + 0x52DCE729;
+            h2 ^= rotateLeft64(k2 * c2, 33) * c1;
+            h2 = (rotateLeft64(h2, 31) + h1) * 5 + 0x38495AB5;
+        }
+
+        uint64_t tail[2] = { 0, 0 };
+        memcpy(tail, data + i, length - i);
+        h2 ^= rotateLeft64(tail[1] * c2, 33) * c1;
+        h1 ^= rotateLeft64(tail[0] * c1, 31) * c2;
+
+        h1 ^= length;
+        h2 ^= length;
+        h1 += h2;
+        h2 += h1;
+        h1 = murmurFinalize64(h1);
+        h2 = murmurFinalize64(h2);
+        h1 += h2;
+        h2 += h1;
+        return { h1, h2 };
+    }
+
+    // Multiply two 64-bit values to 128 bits and return the low half in a and the high half in b
+    // With __int128 this is a single mul (mulx with BMI2)
+    static void wyMultiply(uint64_t& a, uint64_t& b) {
+        unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        a = static_cast<uint64_t>(product);
+        b = static_cast<uint64_t>(product >> 64);
+    }
+
+    // Multiply two 64-bit values to 128 bits and xor the halves together
+    static uint64_t wyMix(uint64_t a, uint64_t b) {
+        wyMultiply(a, b);
+        return a ^ b;
+    }
+
+    // wyhash (final version 4.2): every step is one 64x64->128-bit multiply of two keyed words, folded by xor
+    // Keys of up to 16 bytes are read as two 64-bit values a and b without a loop: 1-3 bytes as the first,
+    // middle and last byte, 4-16 bytes as four 32-bit loads from both ends, which overlap for short keys.
+    // Longer keys run three independent multiply chains over 48-byte blocks, then 16-byte steps, and
+    // always finish with the last 16 bytes of the key.
+    static uint64_t wyhash(const string& key, uint64_t seed = 0) {
+        const uint64_t secret[4] = { 0x2D358DCCAA6C78A5ULL, 0x8BB84B93962EACC9ULL, 0x4B33A62ED433D4A3ULL, 0x4D5A2DA51DE1AA47ULL };
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(key.data());
+        size_t length = key.size();
+        auto read64 = [](const uint8_t* q) {
+            uint64_t value;
+            memcpy(&value, q, 8);
+            return value;
+        };
+        auto read32 = [](const uint8_t* q) {
+            uint32_t value;
+            memcpy(&value, q, 4);
+            return static_cast<uint64_t>(value);
+        };
+
+        seed ^= wyMix(seed ^ secret[0], secret[1]);
+        uint64_t a, b;
+        if (length <= 16) {
+            if (length >= 4) {
+                size_t middle = (length >> 3) << 2;  // 0 for 4-7 bytes, 4 for 8-16 bytes
+                a = (read32(p) << 32) | read32(p + middle);
+                b = (read32(p + length - 4) << 32) | read32(p + length - 4 - middle);
+            }
+            else if (length > 0) {
+                a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[length >> 1]) << 8) | p[length - 1];
+                b = 0;
+            }
+            else {
+                a = b = 0;
+            }
+        }
+        else {
+            size_t i = length;
+            if (i >= 48) {
+                uint64_t seed1 = seed, seed2 = seed;
+                do {
+                    seed = wyMix(read64(p) ^ secret[1], read64(p + 8) ^ seed);
+                    seed1 = wyMix(read64(p + 16) ^ secret[2], read64(p + 24) ^ seed1);
+                    seed2 = wyMix(read64(p + 32) ^ secret[3], read64(p + 40) ^ seed2);
+                    p += 48;
+                    i -= 48;
+                } while (i >= 48);
+                seed ^= seed1 ^ seed2;
+            }
+            while (i > 16) {
+                seed = wyMix(read64(p) ^ secret[1], read64(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+            a = read64(p + i - 16);
+            b = read64(p + i - 8);
+        }
+
+        a ^= secret[1];
+        b ^= seed;
+        wyMultiply(a, b);
+        return wyMix(a ^ secret[0] ^ length, b ^ secret[1]);
+    }
+
+    // Time a batch kernel over a set of keys and return the throughput in million keys per second
+    template <typename Kernel>
+    double benchmarkBatchKernel(Kernel kernel, const vector<string>& keys, vector<uint16_t>& out) {
+        out.assign(keys.size(), 0);
+        auto start = chrono::steady_clock::now();
+        for (int repetition = 0; repetition < BENCHMARK_REPETITIONS; ++repetition) {
+            kernel(keys.data(), keys.size(), out.data());
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        return keys.size() * static_cast<double>(BENCHMARK_REPETITIONS) / seconds / 1e6;
+    }
+
+    // Return the registered hash function with the given name
+    const HashFunctionEntry& findHashFunction(const string& name) {
+        for (const auto& entry : hashFunctions) {
+            if (entry.name == name) {
+                return entry;
+            }
+        }
+        throw runtime_error("Unknown hash function: " + name);
+    }
+
+    // Time a registered hash function over a set of keys and return million keys per second
+    double benchmarkHashFunction(const HashFunctionEntry& entry, const vector<string>& keys) {
+        vector<uint16_t> out;
+        return benchmarkBatchKernel([&entry](const string* keys, size_t count, uint16_t* out) {
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = static_cast<uint16_t>(entry.hashFunc(keys[i]));
+            }
+        }, keys, out);
+    }
+
+    // Time every registered hash function on every key set, in million keys and in megabytes per second
+    void benchmarkAllHashFunctions(const vector<const Corpus*>& keySets) {
+        cout << "Registered Hash Functions:" << endl;
+        for (const Corpus* corpus : keySets) {
+            size_t totalBytes = 0;
+            for (const auto& key : corpus->keys) {
+                totalBytes += key.size();
+            }
+            double meanLength = static_cast<double>(totalBytes) / corpus->keys.size();
+
+            cout << "  " << corpus->name << " (mean " << fixed << setprecision(1) << meanLength << " bytes):" << endl;
+            for (const auto& entry : hashFunctions) {
+                double throughput = benchmarkHashFunction(entry, corpus->keys);
+                cout << "    " << left << setw(28) << entry.name << right
+                     << setw(9) << setprecision(2) << throughput << " Mkeys/s"
+                     << setw(11) << throughput * meanLength << " MB/s" << endl;
+            }
+            cout << defaultfloat << setprecision(6);
+        }
+    }
+
+    // Read the time-stamp counter, which counts reference cycles; without one, fall back to nanoseconds
+    static uint64_t readCycleCounter() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    // Measure the cycles per byte of a hash on random keys of every size in CYCLE_KEY_SIZES and print one row
+    void benchmarkCyclesPerByte(const string& name, const function<uint64_t(const string&)>& hashFunc) {
+        cout << "  " << left << setw(28) << name << right << fixed << setprecision(2);
+        uint64_t state = BASE_SEED;
+        uint64_t checksum = 0;
+        for (size_t keySize : CYCLE_KEY_SIZES) {
+            vector<string> keys(CYCLE_BENCHMARK_BYTES / keySize, string(keySize, '\0'));
+            for (auto& key : keys) {
+                for (auto& c : key) {
+                    c = static_cast<char>(splitMix64(state));
+                }
+            }
+
+            uint64_t fastest = numeric_limits<uint64_t>::max();
+            for (int pass = 0; pass < CYCLE_BENCHMARK_PASSES; ++pass) {
+                uint64_t start = readCycleCounter();
+                for (const auto& key : keys) {
+                    checksum += hashFunc(key);
+                }
+                fastest = min(fastest, readCycleCounter() - start);
+            }
+            cout << setw(9) << static_cast<double>(fastest) / (keys.size() * keySize);
+        }
+        cout << defaultfloat << setprecision(6) << endl;
+
+        // Keep the hashes live so that the loops are not optimized away
+        volatile uint64_t sink = checksum;
+        (void)sink;
+    }
+
+    // Measure the cycles per byte of every registered hash, of XXH3 with each of its stripe kernels, of the
+    // unmixed CRC32C and of the AES hash with each of their kernels
+    void benchmarkAllCyclesPerByte() {
+        cout << "Cycles per Byte (time-stamp counter, fastest of " << CYCLE_BENCHMARK_PASSES << " passes):" << endl;
+        cout << "  " << left << setw(28) << "Key Bytes:" << right;
+        for (size_t keySize : CYCLE_KEY_SIZES) {
+            cout << setw(9) << keySize;
+        }
+        cout << endl;
+
+        for (const auto& entry : hashFunctions) {
+            benchmarkCyclesPerByte(entry.name, entry.hashFunc);
+        }
+        for (const auto& kernel : XXHash3::kernels()) {
+            benchmarkCyclesPerByte("XXH3 64 (" + kernel.name + " stripes)", [&kernel](const string& key) {
+                return XXHash3::hash(key.data(), key.size(), kernel);
+            });
+        }
+        for (const auto& kernel : Crc32c::kernels()) {
+            benchmarkCyclesPerByte("CRC32C (" + kernel.name + ")", [&kernel](const string& key) {
+                return Crc32c::checksum(key.data(), key.size(), kernel);
+            });
+        }
+        for (const auto& kernel : AesHash::kernels()) {
+            benchmarkCyclesPerByte("AES Hash (" + kernel.name + ")", [&kernel](const string& key) {
+                return AesHash::hash(key.data(), key.size(), kernel);
+            });
+        }
+        XXHash3 stream;
+        benchmarkCyclesPerByte("XXH3 64 (streaming)", [&stream](const string& key) {
+            stream.reset();
+            stream.update(key.data(), key.size());
+            return stream.digest();
+        });
+    }
+
+    // Compare a hash function with its intended replacement on every key set:
+    // chi-square and p-value over 65536 buckets, and throughput
+    void compareHashFunctions(const string& currentName, const string& replacementName,
+        const vector<const Corpus*>& keySets) {
+
+        cout << currentName << " vs " << replacementName << ":" << endl;
+        for (const Corpus* corpus : keySets) {
+            cout << "  " << corpus->name << ":" << endl;
+            double currentThroughput = 0.0;
+            for (const string& name : { currentName, replacementName }) {
+                const HashFunctionEntry& entry = findHashFunction(name);
+
+                // Distribution quality over 65536 buckets
+                vector<int> hashes(65536, 0);
+                for (size_t i = 0; i < corpus->keys.size(); ++i) {
+                    if (corpus->isCounted(i)) {
+                        hashes[entry.hashFunc(corpus->keys[i]) % 65536]++;
+                    }
+                }
+                double chiSquare = computeChiSquare(hashes, corpus->countedKeys());
+
+                // Throughput, relative to the current hash
+                double throughput = benchmarkHashFunction(entry, corpus->keys);
+                if (currentThroughput == 0.0) {
+                    currentThroughput = throughput;
+                }
+
+                cout << "    " << left << setw(28) << name << right
+                     << "Chi-Square: " << setw(12) << chiSquare
+                     << "  P-Value: " << setw(10) << computePValue(chiSquare)
+                     << fixed << setprecision(2) << setw(9) << throughput << " Mkeys/s (x"
+                     << throughput / currentThroughput << ")" << defaultfloat << setprecision(6) << endl;
+            }
+        }
+    }
+
+    // Time the chi-square kernel on a synthetic histogram with the given counter width, check that
+    // pools of 2, 4 and 8 workers give the same result as the calling thread bit for bit, and compare
+    // with the old float pow() loop
+    template <typename Count>
+    void benchmarkChiSquareKernel(const string& label, size_t bucketCount) {
+
+        // Fill the histogram as if 1.5 keys per bucket had been thrown at random
+        vector<Count> counts(bucketCount, 0);
+        uint64_t state = BASE_SEED;
+        uint64_t totalKeys = bucketCount + bucketCount / 2;
+        for (uint64_t key = 0; key < totalKeys; ++key) {
+            counts[splitMix64(state) % bucketCount]++;
+        }
+
+        // Time repeated evaluations on one thread
+        int repetitions = max<int>(1, static_cast<int>((1 << 26) / bucketCount));
+        double chiSquare = 0.0;
+        auto start = chrono::steady_clock::now();
+        for (int repetition = 0; repetition < repetitions; ++repetition) {
+            chiSquare = computeChiSquare(counts.data(), bucketCount, totalKeys);
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        // The result must not depend on the thread count
+        bool reproducible = true;
+        for (size_t threads : { 2, 4, 8 }) {
+            WorkStealingPool pool(threads);
+            reproducible = reproducible && computeChiSquare(counts.data(), bucketCount, totalKeys, &pool) == chiSquare;
+        }
+
+        // The previous float accumulation with pow(), for comparison
+        float expected = static_cast<float>(totalKeys) / static_cast<double>(bucketCount);
+        float floatChiSquare = 0.0;
+        for (Count count : counts) {
+            floatChiSquare += pow(count - expected, 2) / expected;
+        }
+
+        cout << "  " << left << setw(6) << label << right << setw(10) << bucketCount << " buckets: "
+             << fixed << setprecision(2) << setw(8) << bucketCount * static_cast<double>(repetitions) / seconds / 1e9
+             << " Gbuckets/s" << defaultfloat << setprecision(10) << "  Chi-Square: " << chiSquare
+             << setprecision(6) << "  (float pow loop: " << floatChiSquare << ")"
+             << (reproducible ? "" : "  THREAD COUNT CHANGES RESULT") << endl;
+    }
+
+    // Time direct increments against the partitioned counting engine on random buckets, and show which one
+    // countBuckets picks for the table size; returns whether direct increments were faster on int counters
+    bool benchmarkBucketCounting(size_t bucketCount) {
+        const size_t keyCount = size_t(1) << 22;
+        const int repetitions = 5;
+        vector<uint32_t> buckets(keyCount);
+        uint64_t state = BASE_SEED;
+        for (auto& bucket : buckets) {
+            bucket = static_cast<uint32_t>(splitMix64(state) % bucketCount);
+        }
+
+        // Time one engine; the counters are cleared outside the timed region
+        auto measure = [&](auto engine, auto& counts, auto clear) {
+            double seconds = 0.0;
+            for (int repetition = 0; repetition < repetitions; ++repetition) {
+                clear(counts);
+                auto start = chrono::steady_clock::now();
+                engine(buckets.data(), keyCount, counts);
+                seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            }
+            return keyCount * static_cast<double>(repetitions) / seconds / 1e6;
+        };
+        auto clearInts = [](vector<int>& counts) { fill(counts.begin(), counts.end(), 0); };
+        auto clearCompact = [](CompactCounterArray& counts) { counts.clear(); };
+        vector<int> directCounts(bucketCount);
+        vector<int> partitionedCounts(bucketCount);
+        CompactCounterArray compactCounts(bucketCount);
+        double direct = measure(directCount<vector<int>>, directCounts, clearInts);
+        double partitioned = measure(partitionedCount<vector<int>>, partitionedCounts, clearInts);
+        double compactDirect = measure(directCount<CompactCounterArray>, compactCounts, clearCompact);
+        double compact = measure(partitionedCount<CompactCounterArray>, compactCounts, clearCompact);
+        bool agree = directCounts == partitionedCounts;
+        for (size_t bucket = 0; agree && bucket < bucketCount; ++bucket) {
+            agree = compactCounts.load(bucket) == static_cast<uint64_t>(directCounts[bucket]);
+        }
+
+        cout << "  2^" << setw(2) << log2(static_cast<double>(bucketCount)) << " buckets: direct "
+             << fixed << setprecision(1) << setw(7) << direct << " Mkeys/s, partitioned " << setw(7) << partitioned
+             << " Mkeys/s; u8 direct " << setw(7) << compactDirect << " Mkeys/s, partitioned " << setw(7) << compact
+             << " Mkeys/s" << defaultfloat << setprecision(6)
+             << "  (auto: " << (bucketCount * sizeof(int) <= directCountLimit ? "direct" : "partitioned")
+             << ", u8 " << (bucketCount <= directCountLimit ? "direct" : "partitioned") << ")"
+             << (agree ? "" : "  ENGINES DISAGREE") << endl;
+        return direct >= partitioned;
+    }
+
+    // Check the p-value engine against Boost over a grid of statistics around the mean (within 8
+    // standard deviations) and far into the upper tail, and time both
+    void benchmarkPValueEngine(double degreesOfFreedom) {
+
+        // Statistics from 8 standard deviations below the mean to 8 above, plus far upper-tail points
+        vector<double> statistics;
+        double sigma = sqrt(2.0 * degreesOfFreedom);
+        for (double z = -8.0; z <= 8.0; z += 0.25) {
+            if (degreesOfFreedom + z * sigma > 0.0) {
+                statistics.push_back(degreesOfFreedom + z * sigma);
+            }
+        }
+        size_t centralCount = statistics.size();
+        for (double z : { 12.0, 20.0, 30.0 }) {
+            statistics.push_back(degreesOfFreedom + z * sigma);
+        }
+
+        // Time the engine (fresh lookups of a cached df) and Boost over the same grid
+        const int repetitions = 200;
+        volatile double sink = 0.0;
+        auto start = chrono::steady_clock::now();
+        for (int repetition = 0; repetition < repetitions; ++repetition) {
+            for (double statistic : statistics) {
+                sink = sink + pValueEngine.tails(statistic, degreesOfFreedom).logUpper;
+            }
+        }
+        double engineNanoseconds = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count()
+            / (repetitions * statistics.size());
+
+        boost::math::chi_squared distribution(degreesOfFreedom);
+        start = chrono::steady_clock::now();
+        for (double statistic : statistics) {
+            sink = sink + boost::math::cdf(boost::math::complement(distribution, statistic));
+        }
+        double boostNanoseconds = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count()
+            / statistics.size();
+
+        // Largest absolute error of either tail near the centre, and largest relative error of the log upper tail far out
+        double maxAbsoluteError = 0.0;
+        double maxLogRelativeError = 0.0;
+        for (size_t i = 0; i < statistics.size(); ++i) {
+            ChiSquareTailEngine::Tails tails = pValueEngine.tails(statistics[i], degreesOfFreedom);
+            double upper = boost::math::cdf(boost::math::complement(distribution, statistics[i]));
+            if (i < centralCount) {
+                double lower = boost::math::cdf(distribution, statistics[i]);
+                maxAbsoluteError = max(maxAbsoluteError, fabs(exp(tails.logLower) - lower));
+                maxAbsoluteError = max(maxAbsoluteError, fabs(exp(tails.logUpper) - upper));
+            }
+            else if (upper > 0.0) {
+                maxLogRelativeError = max(maxLogRelativeError, fabs(tails.logUpper / log(upper) - 1.0));
+            }
+        }
+
+        cout << "  df " << left << setw(10) << static_cast<uint64_t>(degreesOfFreedom) << right
+             << "max |error| " << setw(11) << maxAbsoluteError
+             << "  far-tail log error " << setw(11) << maxLogRelativeError
+             << fixed << setprecision(0) << "  engine " << setw(6) << engineNanoseconds << " ns"
+             << "  Boost " << setw(8) << boostNanoseconds << " ns" << defaultfloat << setprecision(6) << endl;
+    }
+
+    // Stores a batch kernel together with the label it is reported under
+    struct BatchKernel {
+        string label;
+        function<void(const string*, size_t, uint16_t*)> kernel;
+    };
+
+    // Benchmark a family of kernels for a registered hash on each of the given key sets,
+    // and check that every kernel reproduces the registered single-key hash exactly
+    void benchmarkKernelFamily(const string& name, const string& variant,
+        const vector<const Corpus*>& keySets, const vector<BatchKernel>& kernels) {
+
+        // Find the registered hash function the kernels must agree with
+        const HashFunctionEntry* entry = &findHashFunction(name);
+
+        for (const Corpus* corpus : keySets) {
+            cout << name << " (" << variant << ", " << corpus->name << "):" << endl;
+            vector<uint16_t> out;
+
+            // Count the bytes hashed per pass to report MB/s next to keys per second
+            double averageLength = 0.0;
+            for (const auto& key : corpus->keys) {
+                averageLength += key.size();
+            }
+            averageLength /= corpus->keys.size();
+
+            // The registered single-key hash is the baseline for the speedups
+            double baseline = benchmarkBatchKernel([entry](const string* keys, size_t count, uint16_t* out) {
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = static_cast<uint16_t>(entry->hashFunc(keys[i]));
+                }
+            }, corpus->keys, out);
+            cout << "  " << left << setw(14) << "single key" << right << fixed << setprecision(2)
+                 << setw(9) << baseline << " Mkeys/s" << setw(10) << baseline * averageLength << " MB/s"
+                 << defaultfloat << setprecision(6) << endl;
+
+            for (const auto& batch : kernels) {
+                double throughput = benchmarkBatchKernel(batch.kernel, corpus->keys, out);
+
+                // Compare with the registered hash function
+                bool identical = true;
+                for (size_t i = 0; i < corpus->keys.size(); ++i) {
+                    identical = identical && out[i] == entry->hashFunc(corpus->keys[i]) % 65536;
+                }
+
+                cout << "  " << left << setw(14) << batch.label << right << fixed << setprecision(2)
+                     << setw(9) << throughput << " Mkeys/s" << setw(10) << throughput * averageLength << " MB/s"
+                     << "  (x" << throughput / baseline << ")" << defaultfloat << setprecision(6)
+                     << (identical ? "" : "  OUTPUT MISMATCH") << endl;
+            }
+        }
+    }
+
+    // Compute p-value based on the chi-square statistic
+    double computePValue(double chiSquare, double degreesOfFreedom = 65535.0) {
+
+        // Return the cumulative distribution function (CDF) value for the given chi-square statistic
+        return exp(pValueEngine.tails(chiSquare, degreesOfFreedom).logLower);
+    }
+
+    // Compute the base-10 logarithms of both tail probabilities of the chi-square statistic;
+    // unlike the p-value itself, these do not saturate at 0 or 1 for very bad hashes
+    ChiSquareTailEngine::Tails computeLog10Tails(double chiSquare, double degreesOfFreedom = 65535.0) {
+        ChiSquareTailEngine::Tails tails = pValueEngine.tails(chiSquare, degreesOfFreedom);
+        return { tails.logLower / M_LN10 + 0.0, tails.logUpper / M_LN10 + 0.0 };
+    }
+
+    // Compute the G-test (log-likelihood ratio) on a histogram: G = 2 * sum(c * ln(c / e))
+    // At a few keys per bucket G is far from its chi-square limit (at 1.56 keys per bucket its mean is about
+    // 1.16 (B - 1)), so the chi-square tail would call every hash too uneven. In this sparse regime G is
+    // asymptotically normal instead (Morris, 1975), with the mean and variance of a sum over independent
+    // Poisson(e) loads conditioned on their total: B E[f] and B (Var[f] - Cov[f, c]^2 / e), f(c) = 2 c ln(c / e).
+    // The p-value is the normal CDF of G, a CDF like the chi-square one.
+    TestResult computeGTest(const vector<int>& hashes, size_t totalKeys) {
+
+        // Sum c * ln(c) over the non-empty buckets; since sum(c) = N, G = 2 * (sum(c ln c) - N ln e)
+        double sumCLogC = 0.0;
+        for (int count : hashes) {
+            if (count > 1) {
+                sumCLogC += count * log(static_cast<double>(count));
+            }
+        }
+        double expected = static_cast<double>(totalKeys) / hashes.size();
+        double g = 2.0 * (sumCLogC - totalKeys * log(expected));
+
+        // Moments of f(c) under Poisson(e); the terms fall quickly once k is above the mean
+        double meanF = 0.0;
+        double meanFSquared = 0.0;
+        double meanFC = 0.0;
+        for (double k = 1.0; k <= totalKeys; k += 1.0) {
+            double probability = exp(-expected + k * log(expected) - lgamma(k + 1.0));
+            double f = 2.0 * k * log(k / expected);
+            meanF += probability * f;
+            meanFSquared += probability * f * f;
+            meanFC += probability * f * k;
+            if (k > expected && probability < 1e-18) {
+                break;
+            }
+        }
+        double covariance = meanFC - meanF * expected;
+        double mean = hashes.size() * meanF;
+        double variance = hashes.size() * (meanFSquared - meanF * meanF - covariance * covariance / expected);
+        return { g, 0.5 * erfc(-(g - mean) / sqrt(2.0 * variance)) };
+    }
+
+    // Count the empty buckets, singleton buckets and colliding key pairs of a histogram in one pass and
+    // compare them with their exact expectations and variances for N keys thrown into B buckets
+    static OccupancyResult computeOccupancy(const vector<int>& hashes, size_t totalKeys) {
+        return computeOccupancy(hashes, totalKeys, hashes.size());
+    }
+
+    // Same, for loads that may leave out empty buckets (a sparse histogram): buckets missing from the loads are
+    // counted as empty
+    // The variances are written as E - E^2 plus a small correction computed with expm1, so that they keep their
+    // precision when B is far larger than N and E^2 dwarfs the variance
+    static OccupancyResult computeOccupancy(const vector<int>& loads, size_t totalKeys, uint64_t bucketCount) {
+        uint64_t nonEmpty = 0;
+        uint64_t singletons = 0;
+        uint64_t collidingPairs = 0;
+        for (int count : loads) {
+            nonEmpty += count != 0;
+            singletons += count == 1;
+            collidingPairs += static_cast<uint64_t>(count) * (count - 1) / 2;
+        }
+        return computeOccupancy(nonEmpty, singletons, collidingPairs, totalKeys, bucketCount);
+    }
+
+    // Same, for compact counters: the bytes are tallied first, then every spilled bucket replaces the pairs of
+    // its saturated 255 by those of its exact load
+    static OccupancyResult computeOccupancy(const CompactCounterArray& counts, size_t totalKeys) {
+        uint64_t nonEmpty = 0;
+        uint64_t singletons = 0;
+        uint64_t collidingPairs = 0;
+        const uint8_t* bytes = counts.data();
+        for (size_t i = 0; i < counts.size(); ++i) {
+            uint64_t count = bytes[i];
+            nonEmpty += count != 0;
+            singletons += count == 1;
+            collidingPairs += count * (count - 1) / 2;
+        }
+        for (const auto& spilled : counts.spilled()) {
+            uint64_t load = CompactCounterArray::SATURATED + spilled.second;
+            collidingPairs += load * (load - 1) / 2
+                - CompactCounterArray::SATURATED * (CompactCounterArray::SATURATED - 1) / 2;
+        }
+        return computeOccupancy(nonEmpty, singletons, collidingPairs, totalKeys, counts.size());
+    }
+
+    // Compare tallied occupancy counts with their exact expectations and variances for N keys in B buckets
+    static OccupancyResult computeOccupancy(uint64_t nonEmpty, uint64_t singletons, uint64_t collidingPairs,
+        size_t totalKeys, uint64_t bucketCount) {
+        double n = static_cast<double>(totalKeys);
+        double b = static_cast<double>(bucketCount);
+
+        // log((1 - 2/B) / (1 - 1/B)^2), the log-ratio between the joint and the squared single miss probability
+        double jointLogRatio = log1p(-1.0 / ((b - 1.0) * (b - 1.0)));
+
+        OccupancyResult result;
+
+        // Empty buckets: E = B (1 - 1/B)^N, E[X^2] = E + B (B - 1) (1 - 2/B)^N
+        double expectedEmpty = b * exp(n * log1p(-1.0 / b));
+        result.empty = { static_cast<double>(bucketCount - nonEmpty), expectedEmpty,
+            expectedEmpty + expectedEmpty * expectedEmpty * expm1(log1p(-1.0 / b) + n * jointLogRatio) };
+
+        // Singleton buckets: E = N (1 - 1/B)^(N - 1), E[X^2] = E + N (N - 1) (B - 1) / B (1 - 2/B)^(N - 2)
+        double expectedSingletons = n * exp((n - 1.0) * log1p(-1.0 / b));
+        result.singletons = { static_cast<double>(singletons), expectedSingletons,
+            expectedSingletons + expectedSingletons * expectedSingletons
+                * expm1(log1p(-1.0 / n) - log1p(-1.0 / b) + (n - 2.0) * jointLogRatio) };
+
+        // Colliding pairs: each of the N (N - 1) / 2 key pairs collides with probability 1/B, and the pair
+        // indicators are pairwise independent, so the variance is exactly pairs * (1/B) * (1 - 1/B)
+        double pairs = n * (n - 1.0) / 2.0;
+        result.collidingPairs = { static_cast<double>(collidingPairs), pairs / b, pairs / b * (1.0 - 1.0 / b) };
+        return result;
+    }
+
+    // Print one occupancy statistic as observed against expected, with its z-score and p-value
+    static void printOccupancyStatistic(const string& label, const OccupancyStatistic& statistic) {
+        cout << label << ": " << static_cast<uint64_t>(statistic.observed)
+             << " (expected " << statistic.expected << ", z = " << statistic.zScore()
+             << ", P-Value: " << statistic.pValue() << ")" << endl;
+    }
+
+    // Estimate the entropy of the distribution behind a histogram in one pass
+    // Shannon entropy gets the Miller-Madow correction (m - 1) / 2N for its plug-in bias, where m is the number
+    // of non-empty buckets; the collision (Renyi-2) entropy uses the unbiased estimate sum(c (c - 1)) / N (N - 1)
+    // of the collision probability; the min-entropy is the plug-in -log2(max / N), which errs low
+    static EntropyEstimate computeEntropy(const vector<int>& hashes, size_t totalKeys) {
+        double sumCLogC = 0.0;
+        double collisions = 0.0;
+        int nonEmpty = 0;
+        int largest = 0;
+        for (int count : hashes) {
+            if (count > 0) {
+                ++nonEmpty;
+                largest = max(largest, count);
+                sumCLogC += count * log2(static_cast<double>(count));
+                collisions += static_cast<double>(count) * (count - 1);
+            }
+        }
+
+        double n = static_cast<double>(totalKeys);
+        EntropyEstimate estimate;
+        estimate.shannon = log2(n) - sumCLogC / n + (nonEmpty - 1) / (2.0 * n * log(2.0));
+        // Adding 0.0 turns the -0 of a constant hash into 0
+        estimate.collision = (collisions > 0.0 ? -log2(collisions / (n * (n - 1.0))) : log2(n * (n - 1.0))) + 0.0;
+        estimate.minEntropy = -log2(largest / n) + 0.0;
+        return estimate;
+    }
+
+    // Expected value of the corrected Shannon estimate for N keys from a random oracle into B buckets
+    // Miller-Madow only removes the first-order bias, which leaves a visible gap when keys per bucket are few,
+    // so reports compare the estimate with this reference rather than with log2(B)
+    static double expectedShannonEstimate(size_t totalKeys, size_t bucketCount) {
+        double n = static_cast<double>(totalKeys);
+        double b = static_cast<double>(bucketCount);
+
+        // Every bucket load is Binomial(N, 1/B): sum its terms k log2 k until they vanish above the mean
+        double expectedSumCLogC = 0.0;
+        for (double k = 2.0; k <= n; k += 1.0) {
+            double probability = exp(lgamma(n + 1.0) - lgamma(k + 1.0) - lgamma(n - k + 1.0)
+                - k * log(b) + (n - k) * log1p(-1.0 / b));
+            expectedSumCLogC += b * probability * k * log2(k);
+            if (k > n / b && probability < 1e-18) {
+                break;
+            }
+        }
+        double expectedNonEmpty = b * -expm1(n * log1p(-1.0 / b));
+        return log2(n) - expectedSumCLogC / n + (expectedNonEmpty - 1.0) / (2.0 * n * log(2.0));
+    }
+
+    // Measure the avalanche of a hash on random keys of the given length: flip every input bit of every key
+    // and count, for each pair of input and output bit, how often the output bit flips. For a random function
+    // each count is Binomial(AVALANCHE_KEYS, 1/2), so sum((flips - n/2)^2 / (n/4)) over all pairs is
+    // chi-square with one degree of freedom per pair. A 128-bit hash is measured on all 128 bits.
+    AvalancheResult computeAvalanche(const HashFunctionEntry& entry, size_t keyLength) {
+        int inputBits = static_cast<int>(8 * keyLength);
+        int outputBits = entry.wideHashFunc ? 128 : entry.outputBits;
+        auto fullOutput = [&entry](const string& key) -> Hash128 {
+            return entry.wideHashFunc ? entry.wideHashFunc(key) : Hash128{ entry.hashFunc(key), 0 };
+        };
+
+        vector<uint32_t> flips(static_cast<size_t>(inputBits) * outputBits, 0);
+        uint64_t state = BASE_SEED;
+        string key(keyLength, '\0');
+        for (int k = 0; k < AVALANCHE_KEYS; ++k) {
+            for (auto& c : key) {
+                c = static_cast<char>(splitMix64(state));
+            }
+            Hash128 base = fullOutput(key);
+
+            for (int bit = 0; bit < inputBits; ++bit) {
+                key[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+                Hash128 flipped = fullOutput(key);
+                key[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+
+                uint64_t differenceLow = base.low ^ flipped.low;
+                uint64_t differenceHigh = base.high ^ flipped.high;
+                uint32_t* row = &flips[static_cast<size_t>(bit) * outputBits];
+                for (int out = 0; out < outputBits; ++out) {
+                    row[out] += static_cast<uint32_t>((out < 64 ? differenceLow >> out : differenceHigh >> (out - 64)) & 1);
+                }
+            }
+        }
+
+        AvalancheResult result = { 0.0, -1.0, 0, 0, 0.0, static_cast<double>(flips.size()) };
+        double half = AVALANCHE_KEYS / 2.0;
+        uint64_t totalFlips = 0;
+        for (size_t cell = 0; cell < flips.size(); ++cell) {
+            totalFlips += flips[cell];
+            double deviation = flips[cell] - half;
+            result.chiSquare += deviation * deviation / (half / 2.0);
+            double bias = fabs(deviation) / half;
+            if (bias > result.worstBias) {
+                result.worstBias = bias;
+                result.worstInputBit = static_cast<int>(cell / outputBits);
+                result.worstOutputBit = static_cast<int>(cell % outputBits);
+            }
+        }
+        result.meanFlip = static_cast<double>(totalFlips) / (static_cast<double>(AVALANCHE_KEYS) * flips.size());
+        return result;
+    }
+
+    // Estimate the entropy of every ENTROPY_WINDOW_BITS-wide window of the hash outputs, at every offset
+    // that fits in the output, so that a weak byte is not hidden by the strong bits around it
+    vector<EntropyEstimate> computeWindowEntropies(const vector<uint64_t>& outputs, int outputBits) {
+        vector<EntropyEstimate> estimates;
+        uint64_t mask = (1ULL << ENTROPY_WINDOW_BITS) - 1;
+        for (int offset = 0; offset + ENTROPY_WINDOW_BITS <= outputBits; offset += ENTROPY_WINDOW_BITS) {
+            vector<int> window(mask + 1, 0);
+            for (uint64_t output : outputs) {
+                window[(output >> offset) & mask]++;
+            }
+            estimates.push_back(computeEntropy(window, outputs.size()));
+        }
+        return estimates;
+    }
+
+    // Find the largest count of a run of counts; with a constant length the loop vectorizes
+    template <typename Count>
+    static int maxCount(const Count* block, size_t length) {
+        Count largest = 0;
+        for (size_t i = 0; i < length; ++i) {
+            largest = max(largest, block[i]);
+        }
+        return largest;
+    }
+
+    // Find the exact maximum bucket load of a histogram, block by block like the chi-square kernel
+    static int computeMaxLoad(const vector<int>& hashes) {
+        int maxLoad = 0;
+        for (size_t begin = 0; begin < hashes.size(); begin += CHI_SQUARE_BLOCK) {
+            size_t length = min(CHI_SQUARE_BLOCK, hashes.size() - begin);
+            maxLoad = max(maxLoad, length == CHI_SQUARE_BLOCK
+                ? maxCount(hashes.data() + begin, CHI_SQUARE_BLOCK) : maxCount(hashes.data() + begin, length));
+        }
+        return maxLoad;
+    }
+
+    // Find the exact maximum bucket load of compact counters: the largest byte, unless a bucket spilled
+    static uint64_t computeMaxLoad(const CompactCounterArray& counts) {
+        uint64_t maxLoad = 0;
+        for (size_t begin = 0; begin < counts.size(); begin += CHI_SQUARE_BLOCK) {
+            size_t length = min(CHI_SQUARE_BLOCK, counts.size() - begin);
+            maxLoad = max<uint64_t>(maxLoad, length == CHI_SQUARE_BLOCK
+                ? maxCount(counts.data() + begin, CHI_SQUARE_BLOCK) : maxCount(counts.data() + begin, length));
+        }
+        for (const auto& spilled : counts.spilled()) {
+            maxLoad = max<uint64_t>(maxLoad, CompactCounterArray::SATURATED + spilled.second);
+        }
+        return maxLoad;
+    }
+
+    // Count how many buckets hold each load
+    // Four interleaved tables keep runs of equal loads from serializing on a single counter
+    static LoadDistribution computeLoadDistribution(const vector<int>& hashes) {
+        return computeLoadDistribution(hashes, hashes.size());
+    }
+
+    // Same, for loads that may leave out empty buckets; the missing buckets are counted with load 0
+    static LoadDistribution computeLoadDistribution(const vector<int>& hashes, uint64_t bucketCount) {
+        LoadDistribution distribution;
+        distribution.maxLoad = computeMaxLoad(hashes);
+
+        int limit = min(distribution.maxLoad, LOAD_DISTRIBUTION_LIMIT);
+        size_t entries = limit + 1;
+        vector<uint64_t> tables(4 * entries, 0);
+        for (size_t i = 0; i < hashes.size(); ++i) {
+            tables[(i & 3) * entries + min(hashes[i], limit)]++;
+        }
+
+        distribution.bucketsWithLoad.assign(entries, 0);
+        for (size_t k = 0; k < entries; ++k) {
+            distribution.bucketsWithLoad[k] = tables[k] + tables[entries + k] + tables[2 * entries + k]
+                + tables[3 * entries + k];
+        }
+        distribution.bucketsWithLoad[0] += bucketCount - hashes.size();
+        return distribution;
+    }
+
+    // Print the load distribution against the balls-into-bins expectation: N keys thrown into B buckets
+    // give every bucket a Binomial(N, 1/B) load, and the maximum load reaches k with probability
+    // about 1 - (1 - P(load >= k))^B
+    // Returns the probability that a random oracle's maximum load reaches the observed one
+    static double printLoadDistribution(const LoadDistribution& distribution, size_t totalKeys, size_t bucketCount) {
+        double n = static_cast<double>(totalKeys);
+        double b = static_cast<double>(bucketCount);
+
+        // Binomial(N, 1/B) probability of a load of exactly k
+        auto loadProbability = [n, b](double k) {
+            if (k > n) {
+                return 0.0;
+            }
+            return exp(lgamma(n + 1.0) - lgamma(k + 1.0) - lgamma(n - k + 1.0)
+                - k * log(b) + (n - k) * log1p(-1.0 / b));
+        };
+
+        // Binomial probability of a load of at least k; above the mean the terms fall quickly
+        auto loadTail = [&loadProbability, n, b](double k) {
+            if (k <= n / b) {
+                double lower = 0.0;
+                for (double j = 0.0; j < k; j += 1.0) {
+                    lower += loadProbability(j);
+                }
+                return max(0.0, 1.0 - lower);
+            }
+            double tail = 0.0;
+            for (double j = k; j <= n; j += 1.0) {
+                double term = loadProbability(j);
+                tail += term;
+                if (term <= tail * 1e-17) {
+                    break;
+                }
+            }
+            return tail;
+        };
+
+        // Probability that the maximum load reaches k
+        auto maxLoadTail = [&loadTail, b](double k) { return -expm1(b * log1p(-min(1.0, loadTail(k)))); };
+
+        // Expected maximum load: the sum over k >= 1 of P(max >= k)
+        double expectedMaxLoad = 0.0;
+        for (double k = 1.0; k <= n; k += 1.0) {
+            double term = maxLoadTail(k);
+            expectedMaxLoad += term;
+            if (term < 1e-12) {
+                break;
+            }
+        }
+        double maxLoadPValue = maxLoadTail(distribution.maxLoad);
+        cout << "Max Load: " << distribution.maxLoad << " (expected " << expectedMaxLoad
+             << ", P(max >= " << distribution.maxLoad << "): " << maxLoadPValue << ")" << endl;
+
+        // Print one row per load that a random oracle produces at least once on average, then a single row for
+        // every heavier bucket
+        int rows = 0;
+        while (rows < LOAD_DISTRIBUTION_LIMIT - 1 && b * loadProbability(rows + 1.0) >= 0.5) {
+            ++rows;
+        }
+        cout << "Load Distribution (load: observed / expected buckets):" << endl;
+        uint64_t heavier = 0;
+        for (size_t k = 0; k < distribution.bucketsWithLoad.size(); ++k) {
+            if (static_cast<int>(k) <= rows) {
+                cout << "  " << setw(3) << k << ": " << setw(8) << distribution.bucketsWithLoad[k]
+                     << " / " << b * loadProbability(k) << endl;
+            } else {
+                heavier += distribution.bucketsWithLoad[k];
+            }
+        }
+        cout << "  >" << setw(2) << rows << ": " << setw(8) << heavier << " / " << b * loadTail(rows + 1.0) << endl;
+        return maxLoadPValue;
+    }
+
+    // Map a sorted hash output to (0, 1): its top 53 meaningful bits plus half a unit, so that no value
+    // is exactly 0 or 1
+    static double normalizeOutput(uint64_t output, int outputBits) {
+        if (outputBits > 53) {
+            return ldexp(static_cast<double>(output >> (outputBits - 53)) + 0.5, -53);
+        }
+        return ldexp(static_cast<double>(output) + 0.5, -outputBits);
+    }
+
+    // Normalize sorted hash outputs to (0, 1); the mapping is monotonic, so the result stays sorted
+    static vector<double> normalizeOutputs(const vector<uint64_t>& sortedOutputs, int outputBits) {
+        vector<double> uniforms(sortedOutputs.size());
+        for (size_t i = 0; i < sortedOutputs.size(); ++i) {
+            uniforms[i] = normalizeOutput(sortedOutputs[i], outputBits);
+        }
+        return uniforms;
+    }
+
+    // Kolmogorov-Smirnov test of sorted values against the uniform distribution on (0, 1)
+    // The p-value is the asymptotic Kolmogorov tail with Stephens' small-sample correction
+    static TestResult kolmogorovSmirnovUniform(const vector<double>& sorted) {
+        double n = sorted.size();
+        double d = 0.0;
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            d = max(d, max((i + 1) / n - sorted[i], sorted[i] - i / n));
+        }
+
+        // Q(lambda) = 2 * sum((-1)^(j - 1) * exp(-2 j^2 lambda^2)), which is 1 for small lambda
+        double lambda = (sqrt(n) + 0.12 + 0.11 / sqrt(n)) * d;
+        double pValue = 1.0;
+        if (lambda > 0.3) {
+            pValue = 0.0;
+            for (int j = 1; j <= 100; ++j) {
+                double term = exp(-2.0 * j * j * lambda * lambda);
+                pValue += (j % 2 == 1 ? 2.0 : -2.0) * term;
+                if (term < 1e-300) {
+                    break;
+                }
+            }
+            pValue = min(1.0, max(0.0, pValue));
+        }
+        return { d, pValue };
+    }
+
+    // Anderson-Darling test of sorted values against the uniform distribution on (0, 1)
+    // A^2 = -n - (1 / n) * sum((2i - 1) * (ln u_i + ln(1 - u_(n + 1 - i)))), which weights the tails
+    // more heavily than Kolmogorov-Smirnov; values of exactly 0 or 1 are pulled inside so A^2 stays finite
+    static TestResult andersonDarlingUniform(const vector<double>& sorted) {
+        const double smallest = numeric_limits<double>::min();
+        const double largest = nextafter(1.0, 0.0);
+        size_t n = sorted.size();
+        double sum = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            double low = min(largest, max(smallest, sorted[i]));
+            double high = min(largest, max(smallest, sorted[n - 1 - i]));
+            sum += (2.0 * i + 1.0) * (log(low) + log1p(-high));
+        }
+        double a2 = -static_cast<double>(n) - sum / n;
+        return { a2, andersonDarlingUpperTail(a2) };
+    }
+
+    // Upper tail of the limiting Anderson-Darling distribution: Marsaglia and Marsaglia's (2004)
+    // approximation up to 8, then the largest-eigenvalue asymptote sqrt(3) * erfc(sqrt(z))
+    static double andersonDarlingUpperTail(double z) {
+        if (z <= 0.0) {
+            return 1.0;
+        }
+        if (z < 2.0) {
+            return 1.0 - exp(-1.2337141 / z) / sqrt(z)
+                * (2.00012 + (0.247105 - (0.0649821 - (0.0347962 - (0.011672 - 0.00168691 * z) * z) * z) * z) * z);
+        }
+        if (z < 8.0) {
+            return -expm1(-exp(1.0776 - (2.30695 - (0.43424 - (0.082433 - (0.008056 - 0.0003146 * z) * z) * z) * z) * z));
+        }
+        return sqrt(3.0) * erfc(sqrt(z));
+    }
+
+    // Turn a chi-square CDF into a two-sided p-value: a histogram too even is as suspect as one too uneven
+    static double twoSidedPValue(double cdf) {
+        return min(1.0, 2.0 * min(cdf, 1.0 - cdf));
+    }
+
+    // Record a p-value of the report in progress
+    void recordPValue(const string& hashName, const string& test, double pValue) {
+        reportPValues.push_back({ hashName, test, pValue });
+    }
+
+    // Return whether the sequential screening rejected a hash on a corpus
+    bool isScreenedOut(const string& hashName, const string& corpusName) const {
+        return find(screenedOut.begin(), screenedOut.end(), make_pair(hashName, corpusName)) != screenedOut.end();
+    }
+
+    // Record a cell the report in progress skipped because the screening rejected it
+    void recordScreenedOut(const string& hashName, const string& corpusName) {
+        reportScreenedOut.push_back({ hashName, corpusName });
+    }
+
+    // Print how many key hashes a pass skipped on the cells the screening rejected
+    void printScreeningSavings(size_t screenedKeys) const {
+        cout << "Screened Out: " << screenedKeys << " key hashes skipped on cells the sequential screening rejected"
+             << endl;
+    }
+
+    // Adjust p-values with Holm's step-down correction, which bounds the chance of any false rejection
+    static vector<double> holmAdjust(const vector<double>& pValues) {
+        size_t m = pValues.size();
+        vector<size_t> order(m);
+        for (size_t i = 0; i < m; ++i) {
+            order[i] = i;
+        }
+        sort(order.begin(), order.end(), [&pValues](size_t a, size_t b) { return pValues[a] < pValues[b]; });
+
+        // The i-th smallest p-value is scaled by (m - i), then made non-decreasing from the smallest up
+        vector<double> adjusted(m);
+        double running = 0.0;
+        for (size_t i = 0; i < m; ++i) {
+            running = max(running, min(1.0, (m - i) * pValues[order[i]]));
+            adjusted[order[i]] = running;
+        }
+        return adjusted;
+    }
+
+    // Adjust p-values with the Benjamini-Hochberg step-up procedure, which bounds the expected share of false
+    // rejections among all rejections
+    static vector<double> benjaminiHochbergAdjust(const vector<double>& pValues) {
+        size_t m = pValues.size();
+        vector<size_t> order(m);
+        for (size_t i = 0; i < m; ++i) {
+            order[i] = i;
+        }
+        sort(order.begin(), order.end(), [&pValues](size_t a, size_t b) { return pValues[a] < pValues[b]; });
+
+        // The i-th smallest p-value is scaled by m / (i + 1), then made non-increasing from the largest down
+        vector<double> adjusted(m);
+        double running = 1.0;
+        for (size_t i = m; i-- > 0;) {
+            running = min(running, min(1.0, m / (i + 1.0) * pValues[order[i]]));
+            adjusted[order[i]] = running;
+        }
+        return adjusted;
+    }
+
+    // Correct every p-value of the report in progress and print one verdict per hash, then clear the records
+    // A hash FAILs when one of its Holm-adjusted p-values, over the whole report, is below HOLM_ALPHA
+    // The other hashes are then corrected together with Benjamini-Hochberg, leaving out the failed ones, whose
+    // many rejections would otherwise loosen the threshold for everybody else; a hash whose adjusted p-value
+    // falls below BH_FDR is SUSPICIOUS, and every other hash PASSes
+    void printVerdicts(const string& reportName) {
+        size_t m = reportPValues.size();
+        if (m == 0 && reportScreenedOut.empty()) {
+            return;
+        }
+
+        // Gather the hashes in the order they were first reported
+        vector<string> names;
+        for (const auto& record : reportPValues) {
+            if (find(names.begin(), names.end(), record.hashName) == names.end()) {
+                names.push_back(record.hashName);
+            }
+        }
+        for (const auto& cell : reportScreenedOut) {
+            if (find(names.begin(), names.end(), cell.first) == names.end()) {
+                names.push_back(cell.first);
+            }
+        }
+
+        // Holm over the whole report
+        vector<double> pValues(m);
+        for (size_t i = 0; i < m; ++i) {
+            pValues[i] = reportPValues[i].pValue;
+        }
+        vector<double> holm = holmAdjust(pValues);
+        vector<string> failed;
+        for (size_t i = 0; i < m; ++i) {
+            if (holm[i] < HOLM_ALPHA && find(failed.begin(), failed.end(), reportPValues[i].hashName) == failed.end()) {
+                failed.push_back(reportPValues[i].hashName);
+            }
+        }
+
+        // A cell the screening rejected at its own confidence fails its hash without a p-value here
+        for (const auto& cell : reportScreenedOut) {
+            if (find(failed.begin(), failed.end(), cell.first) == failed.end()) {
+                failed.push_back(cell.first);
+            }
+        }
+
+        // Benjamini-Hochberg over the hashes that did not fail; failed hashes keep an adjusted value of 0
+        vector<size_t> survivors;
+        vector<double> survivorPValues;
+        for (size_t i = 0; i < m; ++i) {
+            if (find(failed.begin(), failed.end(), reportPValues[i].hashName) == failed.end()) {
+                survivors.push_back(i);
+                survivorPValues.push_back(pValues[i]);
+            }
+        }
+        vector<double> survivorAdjusted = benjaminiHochbergAdjust(survivorPValues);
+        vector<double> benjaminiHochberg(m, 0.0);
+        for (size_t i = 0; i < survivors.size(); ++i) {
+            benjaminiHochberg[survivors[i]] = survivorAdjusted[i];
+        }
+
+        printHorizontalLine(HISTOGRAM_WIDTH);
+        cout << "Verdicts for " << reportName << " (" << m << " p-values, Holm at " << HOLM_ALPHA
+             << ", Benjamini-Hochberg at " << BH_FDR << "):" << endl;
+        printHorizontalLine(HISTOGRAM_WIDTH / 2);
+        for (const auto& name : names) {
+
+            // Report each hash by its smallest raw p-value
+            int tests = 0;
+            size_t worst = m;
+            for (size_t i = 0; i < m; ++i) {
+                if (reportPValues[i].hashName == name) {
+                    ++tests;
+                    if (worst == m || pValues[i] < pValues[worst]) {
+                        worst = i;
+                    }
+                }
+            }
+            string screened;
+            for (const auto& cell : reportScreenedOut) {
+                if (cell.first == name) {
+                    screened += (screened.empty() ? "" : ", ") + cell.second;
+                }
+            }
+            string verdict = !screened.empty() || holm[worst] < HOLM_ALPHA ? "FAIL"
+                : benjaminiHochberg[worst] < BH_FDR ? "SUSPICIOUS" : "PASS";
+            cout << left << setw(28) << name << setw(12) << verdict << right << setw(4) << tests << " tests";
+            if (worst < m) {
+                cout << "  worst: " << reportPValues[worst].test << " (P-Value: " << pValues[worst]
+                     << ", Holm " << holm[worst] << ", BH " << benjaminiHochberg[worst] << ")";
+            }
+            if (!screened.empty()) {
+                cout << "  screened out on " << screened;
+            }
+            cout << endl;
+        }
+        reportPValues.clear();
+        reportScreenedOut.clear();
+    }
+
+    // Load dictionary from a file and store words in the 'words' vector
+    void loadDictionary() {
+        
+        // Open the dictionary file for reading
+        ifstream dictFile(DICTIONARY_PATH);
+
+        // If the file could not be opened, throw an error
+        if (!dictFile) {
+            throw runtime_error("Could not open dictionary file");
+        }
+        
+        // Define string variable to store each word from the dictionary file temporarily
+        string word;
+
+        // Read each line (word) from the dictionary file and add to the 'words' vector
+        while (getline(dictFile, word)) {
+            words.push_back(word);
+        }
+
+        // Every test of the dictionary needs at least one word
+        if (words.empty()) {
+            throw runtime_error("Dictionary file is empty");
+        }
+    }
+
+    // Print a horizontal line of dashes of a specified length
+    void printHorizontalLine(int length = -1) {
+
+        // If length is not specified, use default value HISTOGRAM_WIDTH
+        if (length == -1) {
+            length = HISTOGRAM_WIDTH;
+        }
+
+        // Print horizontal line to console
+        cout << string(length - 1, '-') << endl;
+
+
+    }
+
+// Print a histogram of hash values, divided into 16 segments
+void printHistogram(const vector<int>& hashes) {
+    
+    // Define integer to store the maximum hash value
+    int maxCount = *max_element(hashes.begin(), hashes.end());
+
+    // Define integer to store the minimum hash value
+    int minCount = *min_element(hashes.begin(), hashes.end());
+
+    // Define vector of 16 integers initialized to 0 to store the maximum value for each segment
+    vector<int> segmentMaxCounts(16, 0);
+    for (size_t i = 0; i < 16; ++i) {
+        // Calculate the starting and ending indices for each segment
+        size_t start = i * 4096;
+        size_t end = min((i + 1) * 4096, hashes.size());
+        
+        // Find the maximum hash value within the current segment
+        auto segmentMax = *max_element(
+            hashes.begin() + start, 
+            hashes.begin() + end
+        );
+        // Store the segment's maximum value
+        segmentMaxCounts[i] = segmentMax;
+    }
+
+
+    // Normalize the maximum counts for each segment to fit within the histogram height
+    vector<int> normalizedSegments(16);
+
+    // Iterate over the 16 segments of the hash data
+    for (size_t i = 0; i < 16; ++i) {
+
+        // Normalize the maximum count for the current segment to fit within the histogram height
+        normalizedSegments[i] = round(
+
+            // Subtract the minimum count to shift the range to start from 0
+            ((segmentMaxCounts[i] - minCount) /
+
+            // Divide by the range (maxCount - minCount) to scale the value between 0 and 1
+            static_cast<double>(maxCount - minCount)) * 
+
+            // Multiply by (HISTOGRAM_HEIGHT - 1) to scale the value to fit within the histogram height range
+            (HISTOGRAM_HEIGHT - 1) 
+        );
+    }
+
+
+
+        // Print histogram header
+        cout << "Histogram (Hashes Distribution):" << endl;
+
+        // Print top line of histogram
+        printHorizontalLine(HISTOGRAM_WIDTH);
+    
+        // Loop through each row of the histogram, starting from the top (HISTOGRAM_HEIGHT - 1)
+        for (int row = HISTOGRAM_HEIGHT - 1; row >= 0; --row) {
+
+            // Print the left border of the histogram
+            cout << "|";
+
+            // Loop through each column (representing a segment) of the histogram
+            for (size_t col = 0; col < 16; ++col) {
+
+                // Print a '#' character if the normalized value for the segment reaches or exceeds the current row
+                // Otherwise, print spaces for that segment's column
+                cout << (normalizedSegments[col] >= row ? "   #" : "    ");
+            }
+
+            // Print the right border and move to the next line
+            cout << "   |" << endl;
+        }
+
+        // Print bottom line of the histogram
+        printHorizontalLine(HISTOGRAM_WIDTH);
+        
+        // Print a space before the X-axis labels (segment numbers)
+        cout << " ";
+
+        // Iterate through 16 segments to print the labels (0 to 15)
+        for (int i = 0; i < 16; ++i) {
+
+            // Print each segment number with a width of 4 characters for proper alignment
+            cout << setw(4) << i;
+        }
+
+        // Move to the next line after printing all the labels
+        cout << endl;
+    }
+
+
+    // Add a hash function to the list of functions evaluated by every test
+    void registerHashFunction(const string& name,
+        const function<uint64_t(const string&)>& hashFunc, int outputBits = 16) {
+        hashFunctions.push_back({ name, hashFunc, outputBits, nullptr, nullptr, true });
+    }
+
+    // Add a hash function with a 128-bit output; the low half is tested like any 64-bit output, and the
+    // tests on the outputs themselves also see the high half
+    void registerWideHashFunction(const string& name, const function<Hash128(const string&)>& wideHashFunc) {
+        hashFunctions.push_back({ name, [wideHashFunc](const string& key) {
+            return wideHashFunc(key).low;
+        }, 64, wideHashFunc, nullptr, true });
+    }
+
+    // Add a seeded hash family; every test sees it with the first seed of generateSeeds, and the dictionary
+    // tests also evaluate it over SEED_COUNT seeds
+    void registerSeededHashFunction(const string& name,
+        const function<uint64_t(const string&, uint64_t)>& seededHashFunc, int outputBits = 16) {
+        uint64_t seed = generateSeeds(1)[0];
+        hashFunctions.push_back({ name, [seededHashFunc, seed](const string& key) {
+            return seededHashFunc(key, seed);
+        }, outputBits, nullptr, seededHashFunc, true });
+    }
+
+    // Register the hash functions under test
+    void registerHashFunctions() {
+
+        // String Length Hash
+        // This hash hashes a string based on its length modulo 65536
+        registerHashFunction("String Length", [](const string& word) {
+            return word.length() % 65536;  // Return the length of the string modulo 65536
+        });
+
+        // First Character Hash
+        // This hash hashes a string based on the first character (sanitized) modulo 65536
+        registerHashFunction("First Character", [this](const string& word) {
+            return word.empty() ? 0 : sanitizeChar(word[0]) % 65536;  // If empty, return 0, else sanitize and hash the first character
+        });
+
+        // Additive Checksum Hash
+        // This hash computes a checksum by adding sanitized character values modulo 65536
+        registerHashFunction("Additive Checksum", [this](const string& word) {
+            uint16_t h = 0;  // Initialize checksum value
+            for (char c : word) {
+                h = (h + sanitizeChar(c)) % 65536;  // Add sanitized char to checksum, taking modulo 65536
+            }
+            return h;  // Return the checksum value
+        });
+
+        // Remainder Hash
+        // This hash computes a hash by multiplying the current hash by 31, adding the sanitized character, and taking the remainder modulo 65413
+        registerHashFunction("Remainder", [this](const string& word) {
+            const uint16_t m = 65413;  // Define modulus value
+            uint16_t h = 0;  // Initialize hash value
+            for (char c : word) {
+                h = (h * 31 + sanitizeChar(c)) % m;  // Update hash by multiplying by 31 and adding sanitized character
+            }
+            return h;  // Return the final hash value
+        });
+
+        // Multiplicative Hash
+        // This hash uses a multiplicative approach with a constant factor (0.6180339887) to generate the hash
+        registerHashFunction("Multiplicative", [this](const string& word) {
+            double h = 0.0;  // Initialize hash value as a floating-point number
+            for (char c : word) {
+                h = fmod(h * 0.6180339887 + sanitizeChar(c), 1.0);  // Update hash using floating-point multiplication and sanitize char
+            }
+            return static_cast<uint16_t>(h * 65536);  // Scale the result to a uint16_t and return
+        });
+
+        // Fixed-Point Multiplicative Hash
+        // This hash is Knuth's multiplicative method in 64-bit fixed point: h holds a fraction in units of 2^-64,
+        // and multiplying by floor(2^64 * 0.6180339887...) modulo 2^64 keeps exactly the fractional part.
+        // The character is added before the multiply; in the floating-point version it lands in the integer part and fmod drops it.
+        registerHashFunction("Fixed-Point Multiplicative", [this](const string& word) {
+            const uint64_t goldenRatio = 0x9E3779B97F4A7C15ULL;  // Define floor(2^64 / golden ratio)
+            uint64_t h = 0;  // Initialize hash value as a 64-bit fixed-point fraction
+            for (char c : word) {
+                h = (h + sanitizeChar(c)) * goldenRatio;  // Update hash by taking the fractional part of (h + c) * 0.6180339887...
+            }
+            return static_cast<uint16_t>(h >> 48);  // Take the top 16 bits, the same as scaling the fraction by 65536
+        });
+
+        // Standard Library Hash
+        // This hash uses the standard C++ hash function to hash the string; all of its bits are kept
+        registerHashFunction("Standard Library", [](const string& word) {
+            return hash<string>{}(word);  // Use the standard C++ hash function; buckets take it modulo the table size
+        }, 8 * sizeof(size_t));
+
+        // FNV-1a Hashes
+        // These hashes are the 32-bit and 64-bit FNV-1a reference algorithms, one byte per multiply
+        registerHashFunction("FNV-1a 32", [](const string& word) {
+            return fnv1a32(word);
+        }, 32);
+        registerHashFunction("FNV-1a 64", [](const string& word) {
+            return fnv1a64(word);
+        }, 64);
+
+        // Word-at-a-Time FNV Hash
+        // This hash applies the FNV-1a step to 8-byte words and finishes with an avalanche
+        registerHashFunction("FNV-1a 64 Word-at-a-Time", [](const string& word) {
+            return fnv1a64WordAtATime(word);
+        }, 64);
+
+        // MurmurHash3 Hashes
+        // These hashes are the x86_32 and x64_128 variants of MurmurHash3 with seed 0
+        registerHashFunction("MurmurHash3 x86_32", [](const string& word) {
+            return murmur3x86_32(word);
+        }, 32);
+        registerWideHashFunction("MurmurHash3 x64_128", [](const string& word) {
+            return murmur3x64_128(word);
+        });
+
+        // xxHash Hashes
+        // These hashes are XXH64 and the 64-bit XXH3, whose long keys run through vectorized stripe kernels
+        registerHashFunction("XXH64", [](const string& word) {
+            return XXHash64::hash(word.data(), word.size());
+        }, 64);
+        registerHashFunction("XXH3 64", [](const string& word) {
+            return XXHash3::hash(word.data(), word.size());
+        }, 64);
+
+        // CRC32C Hash
+        // This hash is the hardware-accelerated CRC32C of the key; a CRC is linear in its input, so structured keys
+        // give structured low bits, and the MurmurHash3 32-bit finalizer mixes them before buckets are taken
+        // The finalizer is a bijection, so the output is only as random as the CRC: keys of one length that differ
+        // in a few bytes never collide, and a table of 2^32 buckets sees fewer collisions than a random function
+        // gives. No mixer can add bits the 32-bit CRC does not have, so the sparse table tests report the hash
+        // without judging it
+        registerHashFunction("CRC32C", [](const string& word) {
+            return murmurFinalize32(Crc32c::checksum(word.data(), word.size()));
+        }, 32);
+        hashFunctions.back().sparseGated = false;
+
+        // AES Hash
+        // This hash mixes 16-byte blocks with AES encryption rounds, on AES-NI where the CPU has it
+        registerHashFunction("AES Hash", [](const string& word) {
+            return AesHash::hash(word.data(), word.size());
+        }, 64);
+
+        // wyhash
+        // This hash mixes 64-bit words with 128-bit multiplies and reads keys of up to 16 bytes without a loop
+        registerHashFunction("wyhash", [](const string& word) {
+            return wyhash(word);
+        }, 64);
+
+        // Seeded Remainder Hash
+        // This hash draws the multiplier and the initial value of the Remainder hash from the seed
+        registerSeededHashFunction("Seeded Remainder", [this](const string& word, uint64_t seed) {
+            const uint32_t m = 65413;  // Define modulus value
+            uint32_t a = 2 + seed % (m - 2);  // Derive a multiplier in [2, m - 1] from the seed
+            uint32_t h = (seed >> 32) % m;  // Derive the initial hash value from the seed
+            for (char c : word) {
+                h = (h * a + sanitizeChar(c)) % m;  // Update hash by multiplying by the seeded multiplier and adding sanitized character
+            }
+            return h;  // Return the final hash value
+        });
+
+        // Seeded Standard Library Hash
+        // This hash mixes the standard C++ hash with the seed; all 64 bits of the mix are kept
+        registerSeededHashFunction("Seeded Standard Library", [](const string& word, uint64_t seed) {
+            uint64_t state = hash<string>{}(word) ^ seed;  // Combine the standard hash with the seed
+            return splitMix64(state);  // Mix the combined value
+        }, 64);
+    }
+
+    // Check every registered reference algorithm against its published known-answer values
+    // A mismatch means the implementation is wrong, so every result computed from it would be too
+    void checkKnownAnswers() {
+        struct KnownAnswer {
+            string hashName;
+            string input;
+            uint64_t expected;
+        };
+        const vector<KnownAnswer> knownAnswers = {
+            { "FNV-1a 32", "", 0x811C9DC5u },
+            { "FNV-1a 32", "a", 0xE40C292Cu },
+            { "FNV-1a 32", "foobar", 0xBF9CF968u },
+            { "FNV-1a 64", "", 0xCBF29CE484222325ULL },
+            { "FNV-1a 64", "a", 0xAF63DC4C8601EC8CULL },
+            { "FNV-1a 64", "foobar", 0x85944171F73967E8ULL },
+            { "MurmurHash3 x86_32", "", 0 },
+            { "MurmurHash3 x86_32", "hello", 0x248BFA47u },
+            { "MurmurHash3 x86_32", "The quick brown fox jumps over the lazy dog", 0x2E4FF723u },
+            { "XXH64", "", 0xEF46DB3751D8E999ULL },
+            { "XXH64", "a", 0xD24EC4F1A98C6E5BULL },
+            { "XXH64", "The quick brown fox jumps over the lazy dog", 0x0B242D361FDA71BCULL },
+            { "XXH64", string(1000, 'a'), 0x56E43B712EDA4223ULL },
+            { "XXH3 64", "", 0x2D06800538D394C2ULL },
+            { "XXH3 64", "a", 0xE6C632B61E964E1FULL },
+            { "XXH3 64", "abc", 0x78AF5F94892F3950ULL },
+            { "XXH3 64", "hello", 0x9555E8555C62DCFDULL },
+            { "XXH3 64", string(200, 'a'), 0xAC2BD404BCE6C995ULL },
+            { "XXH3 64", string(1000, 'a'), 0xB3E7AF627147DB7CULL },
+        };
+
+        for (const auto& answer : knownAnswers) {
+            uint64_t actual = findHashFunction(answer.hashName).hashFunc(answer.input);
+            if (actual != answer.expected) {
+                ostringstream message;
+                message << answer.hashName << " known-answer test failed for \"" << answer.input << "\": expected 0x"
+                        << hex << answer.expected << ", got 0x" << actual;
+                throw runtime_error(message.str());
+            }
+        }
+
+        // Every CRC32C kernel must give the standard check value, and agree with the others on random keys that
+        // reach the interleaved rounds of both chunk sizes
+        string crcKey(3 * 8192 + 3 * 256 + 100, '\0');
+        uint64_t crcState = BASE_SEED;
+        for (auto& c : crcKey) {
+            c = static_cast<char>(splitMix64(crcState));
+        }
+        for (const auto& kernel : Crc32c::kernels()) {
+            if (Crc32c::checksum("123456789", 9, kernel) != 0xE3069283u) {
+                throw runtime_error("CRC32C " + kernel.name + " kernel known-answer test failed for \"123456789\"");
+            }
+            for (size_t length : { size_t(0), size_t(1), size_t(7), size_t(8), size_t(767), size_t(768), size_t(1029), crcKey.size() }) {
+                if (Crc32c::checksum(crcKey.data(), length, kernel) != Crc32c::checksum(crcKey.data(), length, Crc32c::kernels()[0])) {
+                    throw runtime_error("CRC32C " + kernel.name + " kernel disagrees with the table kernel at " + to_string(length) + " bytes");
+                }
+            }
+        }
+
+        // The software AES round must match FIPS-197's S-box and Intel's worked aesenc example, and every AES
+        // Hash kernel must agree with the portable one on every path
+        const uint8_t* box = AesHash::substitutionBox();
+        if (box[0x00] != 0x63 || box[0x01] != 0x7C || box[0x53] != 0xED || box[0xFF] != 0x16) {
+            throw runtime_error("AES S-box known-answer test failed");
+        }
+        AesHash::Block roundState, roundKey, roundExpected;
+        const uint64_t roundValues[3][2] = {
+            { 0x63746F725D53475DULL, 0x7B5B546573745665ULL },
+            { 0x5B477565726F6E5DULL, 0x4869285368617929ULL },
+            { 0x8B104B58DED7E595ULL, 0xA8311C2F9FDBA3C5ULL },
+        };
+        AesHash::Block* roundBlocks[3] = { &roundState, &roundKey, &roundExpected };
+        for (int i = 0; i < 3; ++i) {
+            memcpy(roundBlocks[i]->bytes, &roundValues[i][0], 8);
+            memcpy(roundBlocks[i]->bytes + 8, &roundValues[i][1], 8);
+        }
+        if (memcmp(AesHash::encryptRound(roundState, roundKey).bytes, roundExpected.bytes, 16) != 0) {
+            throw runtime_error("AES round known-answer test failed");
+        }
+        for (const auto& kernel : AesHash::kernels()) {
+            for (size_t length = 0; length <= 300; ++length) {
+                if (AesHash::hash(crcKey.data(), length, kernel) != AesHash::hash(crcKey.data(), length, AesHash::kernels()[0])) {
+                    throw runtime_error("AES Hash " + kernel.name + " kernel disagrees with the portable one at " + to_string(length) + " bytes");
+                }
+            }
+        }
+
+        // The published wyhash vectors use the index of each message as its seed
+        const vector<string> wyhashMessages = { "", "a", "abc", "message digest", "abcdefghijklmnopqrstuvwxyz",
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+            "12345678901234567890123456789012345678901234567890123456789012345678901234567890" };
+        const vector<uint64_t> wyhashExpected = { 0x93228A4DE0EEC5A2ULL, 0xC5BAC3DB178713C4ULL, 0xA97F2F7B1D9B3314ULL,
+            0x786D1F1DF3801DF4ULL, 0xDCA5A8138AD37C87ULL, 0xB9E734F117CFAF70ULL, 0x6CC5EAB49A92D617ULL };
+        for (size_t i = 0; i < wyhashMessages.size(); ++i) {
+            if (wyhash(wyhashMessages[i], i) != wyhashExpected[i]) {
+                throw runtime_error("wyhash known-answer test failed for \"" + wyhashMessages[i] + "\"");
+            }
+        }
+
+        // 128-bit outputs are checked on both halves
+        struct WideKnownAnswer {
+            string hashName;
+            string input;
+            Hash128 expected;
+        };
+        const vector<WideKnownAnswer> wideKnownAnswers = {
+            { "MurmurHash3 x64_128", "", { 0, 0 } },
+            { "MurmurHash3 x64_128", "hello", { 0xCBD8A7B341BD9B02ULL, 0x5B1E906A48AE1D19ULL } },
+            { "MurmurHash3 x64_128", "The quick brown fox jumps over the lazy dog",
+                { 0xE34BBC7BBC071B6CULL, 0x7A433CA9C49A9347ULL } },
+        };
+
+        for (const auto& answer : wideKnownAnswers) {
+            Hash128 actual = findHashFunction(answer.hashName).wideHashFunc(answer.input);
+            if (actual.low != answer.expected.low || actual.high != answer.expected.high) {
+                ostringstream message;
+                message << answer.hashName << " known-answer test failed for \"" << answer.input << "\": expected 0x"
+                        << hex << answer.expected.high << setfill('0') << setw(16) << answer.expected.low
+                        << ", got 0x" << actual.high << setw(16) << actual.low;
+                throw runtime_error(message.str());
+            }
+        }
+
+        // SMHasher's verification values cover every tail length and 256 seeds: the keys {}, {0}, {0, 1}, ...,
+        // {0, ..., 254} are hashed with seed 256 - length, their outputs are concatenated and hashed with seed 0,
+        // and the first four bytes of that hash must match
+        string verificationKey;
+        string murmur32Outputs;
+        string murmur128Outputs;
+        for (uint32_t length = 0; length < 256; ++length) {
+            uint32_t h32 = murmur3x86_32(verificationKey, 256 - length);
+            Hash128 h128 = murmur3x64_128(verificationKey, 256 - length);
+            murmur32Outputs.append(reinterpret_cast<const char*>(&h32), sizeof(h32));
+            murmur128Outputs.append(reinterpret_cast<const char*>(&h128.low), sizeof(h128.low));
+            murmur128Outputs.append(reinterpret_cast<const char*>(&h128.high), sizeof(h128.high));
+            verificationKey.push_back(static_cast<char>(length));
+        }
+        if (murmur3x86_32(murmur32Outputs) != 0xB0F57EE3u) {
+            throw runtime_error("MurmurHash3 x86_32 SMHasher verification value mismatch");
+        }
+        if (static_cast<uint32_t>(murmur3x64_128(murmur128Outputs).low) != 0x6384BA69u) {
+            throw runtime_error("MurmurHash3 x64_128 SMHasher verification value mismatch");
+        }
+
+        // Every XXH3 stripe kernel, and the streaming API fed in pieces of every size class, must reproduce the
+        // one-shot hash, on keys covering every short path and several blocks
+        string key(XXH3_CHECK_LENGTH, '\0');
+        uint64_t state = BASE_SEED;
+        for (auto& c : key) {
+            c = static_cast<char>(splitMix64(state));
+        }
+        for (size_t length = 0; length <= XXH3_CHECK_LENGTH; length += length < 256 ? 1 : 61) {
+            uint64_t expected = XXHash3::hash(key.data(), length);
+            for (const auto& kernel : XXHash3::kernels()) {
+                if (XXHash3::hash(key.data(), length, kernel) != expected) {
+                    throw runtime_error("XXH3 " + kernel.name + " kernel disagrees with the default one at " + to_string(length) + " bytes");
+                }
+            }
+            for (size_t piece : { 1, 63, 255, 257, 1000 }) {
+                XXHash3 stream;
+                for (size_t offset = 0; offset < length; offset += piece) {
+                    stream.update(key.data() + offset, min(piece, length - offset));
+                }
+                if (stream.digest() != expected) {
+                    throw runtime_error("XXH3 streaming disagrees with the one-shot hash at " + to_string(length) + " bytes");
+                }
+            }
+        }
+    }
+
+    // Build the corpora used by the test matrix
+    void buildCorpora() {
+
+        // The dictionary itself
+        corpora.push_back({ "Dictionary", words, 0, 0.0, {} });
+
+        // Sequential numeric identifiers, a common and highly structured kind of key
+        Corpus sequentialIds = { "Sequential IDs", {}, 0, 0.0, {} };
+        sequentialIds.keys.reserve(SEQUENTIAL_ID_COUNT);
+        for (size_t i = 0; i < SEQUENTIAL_ID_COUNT; ++i) {
+            sequentialIds.keys.push_back("id" + to_string(i));
+        }
+        corpora.push_back(move(sequentialIds));
+
+        // Longer keys made of four consecutive dictionary words
+        Corpus phrases = { "Word Phrases", {}, 0, 0.0, {} };
+        for (size_t i = 0; i + 4 <= words.size(); i += 4) {
+            phrases.keys.push_back(words[i] + " " + words[i + 1] + " " + words[i + 2] + " " + words[i + 3]);
+        }
+        corpora.push_back(move(phrases));
+
+        // Count the distinct keys of every corpus: every corpus gets a HyperLogLog estimate, and small ones also
+        // an exact count with their repeats marked, against which the estimate is checked
+        for (auto& corpus : corpora) {
+            corpus.estimatedDistinctKeys = estimateDistinctKeys(corpus.keys);
+            if (corpus.keys.size() <= EXACT_DISTINCT_LIMIT) {
+                corpus.repeated = markRepeatedKeys(corpus.keys);
+                corpus.distinctKeys = static_cast<size_t>(count(corpus.repeated.begin(), corpus.repeated.end(), false));
+                double error = fabs(corpus.estimatedDistinctKeys - corpus.distinctKeys);
+                if (error > 6.0 * HyperLogLog::standardError() * corpus.distinctKeys) {
+                    throw runtime_error("HyperLogLog estimate too far from the exact distinct count of " + corpus.name);
+                }
+            } else {
+                corpus.distinctKeys = static_cast<size_t>(llround(corpus.estimatedDistinctKeys));
+            }
+        }
+    }
+
+    // Mark every key equal to an earlier one, leaving the keys themselves untouched
+    static vector<bool> markRepeatedKeys(const vector<string>& keys) {
+        unordered_set<string> seen;
+        seen.reserve(keys.size());
+        vector<bool> repeated(keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            repeated[i] = !seen.insert(keys[i]).second;
+        }
+        return repeated;
+    }
+
+    // Mix a 64-bit value for the distinct-count sketches, so that structured values spread over the registers
+    static uint64_t sketchValue(uint64_t value) {
+        return splitMix64(value);
+    }
+
+    // Mix a key for the distinct-count sketches
+    static uint64_t sketchValue(const string& key) {
+        return sketchValue(static_cast<uint64_t>(hash<string>{}(key)));
+    }
+
+    // Estimate the number of distinct keys without storing them: one HyperLogLog sketch per pool task over a
+    // slice of the keys, merged at the end
+    double estimateDistinctKeys(const vector<string>& keys) {
+        size_t sliceCount = max<size_t>(1, (keys.size() + MATRIX_CHUNK_SIZE - 1) / MATRIX_CHUNK_SIZE);
+        vector<HyperLogLog> sketches(sliceCount);
+        {
+            WorkStealingPool pool;
+            for (size_t slice = 0; slice < sliceCount; ++slice) {
+                pool.submit([&, slice]() {
+                    size_t end = min(keys.size(), (slice + 1) * MATRIX_CHUNK_SIZE);
+                    for (size_t i = slice * MATRIX_CHUNK_SIZE; i < end; ++i) {
+                        sketches[slice].add(sketchValue(keys[i]));
+                    }
+                });
+            }
+            pool.wait();
+        }
+        for (size_t slice = 1; slice < sliceCount; ++slice) {
+            sketches[0].merge(sketches[slice]);
+        }
+        return sketches[0].estimate();
+    }
+
+    // Expected number of distinct outputs, S (1 - p1) with p1 = (1 - 1/S)^D, of a random oracle with
+    // S = 2^outputBits outputs fed the D distinct keys of a corpus, with the variance of a HyperLogLog estimate
+    // of it: the oracle's own variance, the sketch's relative error, and, when D is itself an estimate, its error
+    // carried through dE/dD = (1 - 1/S)^D
+    // The oracle's variance is that of its empty outputs, S p1 + S (S - 1) p2 - S^2 p1^2 with p2 = (1 - 2/S)^D,
+    // regrouped as S (p1 - p2) + S^2 (p2 - p1^2) with both differences taken by expm1, so that it stays exact
+    // for a 64-bit S, where the terms of the first form cancel to nothing
+    // The observed count is left at zero for the caller to fill in
+    static OccupancyStatistic expectedDistinctOutputs(const Corpus& corpus, int outputBits) {
+        double space = ldexp(1.0, outputBits);
+        double d = static_cast<double>(corpus.distinctKeys);
+        double missLog = log1p(-1.0 / space);
+        double p1 = exp(d * missLog);
+        double expected = space * -expm1(d * missLog);
+        double oracleVariance = space * -p1 * expm1(d * (log1p(-2.0 / space) - missLog))
+            + space * space * p1 * p1 * expm1(d * log1p(-1.0 / ((space - 1.0) * (space - 1.0))));
+        double sketchError = HyperLogLog::standardError() * expected;
+        double variance = oracleVariance + sketchError * sketchError;
+        if (corpus.repeated.empty()) {
+            double keyError = HyperLogLog::standardError() * d * p1;
+            variance += keyError * keyError;
+        }
+        return { 0.0, expected, variance };
+    }
+
+// Public constructor for the HashFunctionTester class
+public:
+
+
+    // Initializes an object of HashFunctionTester
+    HashFunctionTester() {
+
+        // Calls the loadDictionary function to populate the 'words' vector with words
+        loadDictionary(); 
+
+        // Register the hash functions and build the corpora they are tested against
+        registerHashFunctions();
+        checkKnownAnswers();
+        buildCorpora();
+
+        // Pick the bucket counting engine for this machine
+        directCountLimit = calibrateDirectCountLimit();
+    }
+
+    // Function to test a hash function and print a histogram of hash results
+    // Accepts the registered hash function (its name, the function itself and its output width) as argument
+    void testHashFunction(const HashFunctionEntry& entry) {
+        const string& name = entry.name;
+
+        // The dictionary corpus holds the words as read; repeated words are skipped, and every statistic counts
+        // the distinct words
+        const Corpus& dictionary = corpora[0];
+        size_t wordCount = dictionary.countedKeys();
+
+        // Create a vector to store the hash results, initialized to 0 with a size of 65536
+        vector<int> hashes(65536, 0);
+
+        // Create a vector to store the full output of every word, for the tests on the outputs themselves
+        vector<uint64_t> outputs;
+        outputs.reserve(wordCount);
+
+        // Iterate through each distinct word of the dictionary
+        for (size_t i = 0; i < dictionary.keys.size(); ++i) {
+            if (!dictionary.isCounted(i)) {
+                continue;
+            }
+
+            // Define a 64-bit unsigned integer for the resulting hash of the current word
+            uint64_t h = entry.hashFunc(dictionary.keys[i]);
+            outputs.push_back(h);
+
+            // Increment the corresponding hash bucket (the hash modulo 65536) in the 'hashes' vector
+            hashes[h % 65536]++;
+        }
+
+        // Compute the G-test, the occupancy statistics and the entropy estimates on the same histogram
+        TestResult gTest = computeGTest(hashes, wordCount);
+        OccupancyResult occupancy = computeOccupancy(hashes, wordCount);
+        EntropyEstimate entropy = computeEntropy(hashes, wordCount);
+        vector<EntropyEstimate> windowEntropies = computeWindowEntropies(outputs, entry.outputBits);
+
+        // Sort the outputs once for the Kolmogorov-Smirnov and Anderson-Darling tests on their normalized values
+        sort(outputs.begin(), outputs.end());
+
+        // Count the distinct outputs exactly from the sorted outputs, and with a HyperLogLog sketch as a check
+        size_t distinctOutputs = outputs.empty() ? 0 : 1;
+        HyperLogLog outputSketch;
+        for (size_t i = 0; i < outputs.size(); ++i) {
+            distinctOutputs += i > 0 && outputs[i] != outputs[i - 1];
+            outputSketch.add(sketchValue(outputs[i]));
+        }
+        double outputSpace = ldexp(1.0, entry.outputBits);
+        double expectedDistinctOutputs = outputSpace * -expm1(wordCount * log1p(-1.0 / outputSpace));
+        vector<double> uniforms = normalizeOutputs(outputs, entry.outputBits);
+        TestResult kolmogorovSmirnov = kolmogorovSmirnovUniform(uniforms);
+        TestResult andersonDarling = andersonDarlingUniform(uniforms);
+
+        // Compute the chi-square statistic based on the hash distribution
+        double chiSquare = computeChiSquare(hashes);
+
+        // Compute the p-value from the chi-square statistic
+        double pValue = computePValue(chiSquare);
+
+        // Compute both tails in log space to show how extreme a saturated p-value is
+        ChiSquareTailEngine::Tails log10Tails = computeLog10Tails(chiSquare);
+
+        // Print a horizontal line as a divider between the tests
+        printHorizontalLine(HISTOGRAM_WIDTH);
 
-    // Define constant string that stores the relative file path to "words.txt".
-    const string DICTIONARY_PATH = "./words.txt";
+        // Print the hash function's name
+        cout << name << " Hash:" << endl;
 
-    // Define constant integer for histogram width
-    const int HISTOGRAM_WIDTH = 70;
+        // Print another horizontal line of half the width
+        printHorizontalLine(HISTOGRAM_WIDTH / 2);
 
-    // Define constant inetger for histogram width
-    const int HISTOGRAM_HEIGHT = 10;
+        // Print the chi-square value
+        cout << "Chi-Square: " << chiSquare << endl;
 
-    // Helper function to convert signed char to unsigned
-    uint16_t sanitizeChar(char c) {
-        return static_cast<uint16_t>(static_cast<unsigned char>(c));
-    }
+        // Print the p-value
+        cout << "P-Value: " << pValue << endl;   
 
-   // Compute chi-square statistic for a given set of hashes
-    float computeChiSquare(const vector<int>& hashes) {
+        // Print the base-10 logarithms of the lower and upper tail probabilities
+        cout << "Log10 Tails: lower " << log10Tails.logLower << ", upper " << log10Tails.logUpper << endl;
 
-        // Define integer to store total number of words
-        int totalWords = words.size();
+        // Print the other goodness-of-fit tests; the G-test p-value is a CDF like the chi-square one,
+        // the Kolmogorov-Smirnov and Anderson-Darling p-values are upper tails
+        cout << "G-Test: " << gTest.statistic << " (P-Value: " << gTest.pValue << ")" << endl;
+        cout << "Kolmogorov-Smirnov: D = " << kolmogorovSmirnov.statistic
+             << " (P-Value: " << kolmogorovSmirnov.pValue << ")" << endl;
+        cout << "Anderson-Darling: A^2 = " << andersonDarling.statistic
+             << " (P-Value: " << andersonDarling.pValue << ")" << endl;
 
-        // Calculate the expected value by dividing totalWords by 65536.0
-        float expected = static_cast<float>(totalWords) / 65536.0;
+        // Print the occupancy statistics, whose p-values are two-sided
+        printOccupancyStatistic("Empty Buckets", occupancy.empty);
+        printOccupancyStatistic("Singleton Buckets", occupancy.singletons);
+        printOccupancyStatistic("Colliding Pairs", occupancy.collidingPairs);
 
-        // Initialize chi-square statistic to 0
-        float chiSquare = 0.0;
+        // Print the distinct outputs against the number a random oracle with as many output bits would give
+        cout << "Distinct Outputs: " << distinctOutputs << " of " << wordCount << " (expected "
+             << expectedDistinctOutputs << ", HyperLogLog " << outputSketch.estimate() << ")" << endl;
 
-        // Loop through each count in the hashes vector
-        for (int count : hashes) {
-            // Update chi-square value by adding the contribution of the current count
-            chiSquare += pow(count - expected, 2) / expected;
-        }
+        // Print the exact maximum load and the distribution of bucket loads
+        double maxLoadPValue = printLoadDistribution(computeLoadDistribution(hashes), wordCount, hashes.size());
 
-        // Return the computed chi-square statistic as a float
-        return chiSquare;
-    }
+        // Record the p-values for the verdicts
+        recordPValue(name, "Chi-Square", twoSidedPValue(pValue));
+        recordPValue(name, "G-Test", twoSidedPValue(gTest.pValue));
+        recordPValue(name, "Kolmogorov-Smirnov", kolmogorovSmirnov.pValue);
+        recordPValue(name, "Anderson-Darling", andersonDarling.pValue);
+        recordPValue(name, "Empty Buckets", occupancy.empty.pValue());
+        recordPValue(name, "Singleton Buckets", occupancy.singletons.pValue());
+        recordPValue(name, "Colliding Pairs", occupancy.collidingPairs.pValue());
+        recordPValue(name, "Max Load", maxLoadPValue);
 
-    // Compute p-value based on the chi-square statistic
-    float computePValue(float chiSquare) {
-        
-        // Create a chi-squared distribution with 65535 degrees of freedom using Boost library
-        boost::math::chi_squared c2d(65535.0);
+        // Print the entropy estimates against the 16 bits of a uniform bucket, then the weakest output window
+        cout << "Entropy (bits of 16): Shannon " << entropy.shannon
+             << " (random oracle " << expectedShannonEstimate(wordCount, hashes.size()) << "), Collision "
+             << entropy.collision << ", Min " << entropy.minEntropy << endl;
+        size_t weakest = 0;
+        for (size_t i = 1; i < windowEntropies.size(); ++i) {
+            if (windowEntropies[i].shannon < windowEntropies[weakest].shannon) {
+                weakest = i;
+            }
+        }
+        if (!windowEntropies.empty()) {
+            const EntropyEstimate& window = windowEntropies[weakest];
+            cout << "Weakest " << ENTROPY_WINDOW_BITS << "-Bit Window (bits " << weakest * ENTROPY_WINDOW_BITS
+                 << "-" << (weakest + 1) * ENTROPY_WINDOW_BITS - 1 << " of " << entry.outputBits << "): Shannon "
+                 << window.shannon << ", Collision " << window.collision << ", Min " << window.minEntropy << endl;
+        }
 
-        // Return the cumulative distribution function (CDF) value for the given chi-square statistic
-        return boost::math::cdf(c2d, chiSquare);
+        // Print the histogram of hash results
+        printHistogram(hashes);
     }
 
-    // Load dictionary from a file and store words in the 'words' vector
-    void loadDictionary() {
-        
-        // Open the dictionary file for reading
-        ifstream dictFile(DICTIONARY_PATH);
+    // Function to test a seeded hash family over SEED_COUNT seeds in parallel
+    // Every seed gets its own histogram, chi-square and p-value on a pool task, and the report summarizes
+    // how the p-values are distributed across the seeds; a good family gives uniform p-values, which
+    // Kolmogorov-Smirnov and Anderson-Darling test like the two-level test does for corpus slices
+    void testSeededHashFunction(const HashFunctionEntry& entry) {
+        const string& name = entry.name;
 
-        // If the file could not be opened, throw an error
-        if (!dictFile) {
-            throw runtime_error("Could not open dictionary file");
+        // Generate the seeds and a result slot for each of them
+        vector<uint64_t> seeds = generateSeeds(SEED_COUNT);
+        vector<SeedResult> results(seeds.size());
+
+        // Evaluate every seed on its own task; each task writes only to its own result slot
+        {
+            WorkStealingPool pool;
+            for (size_t index = 0; index < seeds.size(); ++index) {
+                pool.submit([&, index]() {
+                    const Corpus& dictionary = corpora[0];
+                    vector<int> hashes(65536, 0);
+                    for (size_t i = 0; i < dictionary.keys.size(); ++i) {
+                        if (dictionary.isCounted(i)) {
+                            hashes[entry.seededHashFunc(dictionary.keys[i], seeds[index]) % 65536]++;
+                        }
+                    }
+                    double chiSquare = computeChiSquare(hashes);
+                    results[index] = { seeds[index], chiSquare, computePValue(chiSquare) };
+                });
+            }
+            pool.wait();
         }
-        
-        // Define string variable to store each word from the dictionary file temporarily
-        string word;
 
-        // Read each line (word) from the dictionary file and add to the 'words' vector
-        while (getline(dictFile, word)) {
-            words.push_back(word);
+        // Collect and sort the p-values to summarize their distribution
+        vector<double> pValues;
+        for (const auto& result : results) {
+            pValues.push_back(result.pValue);
         }
-    }
+        sort(pValues.begin(), pValues.end());
 
-    // Print a horizontal line of dashes of a specified length
-    void printHorizontalLine(int length = -1) {
+        // Print a horizontal line as a divider between the tests
+        printHorizontalLine(HISTOGRAM_WIDTH);
 
-        // If length is not specified, use default value HISTOGRAM_WIDTH
-        if (length == -1) {
-            length = HISTOGRAM_WIDTH;
-        }
+        // Print the hash family's name and the number of seeds evaluated
+        cout << name << " Hash (" << seeds.size() << " seeds):" << endl;
 
-        // Print horizontal line to console
-        cout << string(length - 1, '-') << endl;
+        // Print another horizontal line of half the width
+        printHorizontalLine(HISTOGRAM_WIDTH / 2);
+
+        // Print the five-number summary of the p-values across seeds
+        cout << "P-Value Min: " << pValues.front() << endl;
+        cout << "P-Value 25%: " << percentile(pValues, 0.25) << endl;
+        cout << "P-Value Median: " << percentile(pValues, 0.5) << endl;
+        cout << "P-Value 75%: " << percentile(pValues, 0.75) << endl;
+        cout << "P-Value Max: " << pValues.back() << endl;
 
+        // Flag seeds whose p-value falls in either 1% tail; about 2% of seeds are expected there by chance
+        int flagged = 0;
+        for (const auto& result : results) {
+            if (result.pValue < 0.01 || result.pValue > 0.99) {
+                cout << "  Seed 0x" << hex << setw(16) << setfill('0') << result.seed << dec << setfill(' ')
+                     << ": Chi-Square " << result.chiSquare << ", P-Value " << result.pValue << endl;
+                flagged++;
+            }
+        }
+        cout << "Seeds in 1% tails: " << flagged << " of " << seeds.size()
+             << " (expected about " << 0.02 * seeds.size() << ")" << endl;
 
+        // Test the per-seed p-values for uniformity
+        TestResult kolmogorovSmirnov = kolmogorovSmirnovUniform(pValues);
+        TestResult andersonDarling = andersonDarlingUniform(pValues);
+        cout << "Seed P-Value Uniformity: KS D = " << kolmogorovSmirnov.statistic
+             << " (P-Value: " << kolmogorovSmirnov.pValue << "), AD A^2 = " << andersonDarling.statistic
+             << " (P-Value: " << andersonDarling.pValue << ")" << endl;
+
+        // Record every seed's p-value and the uniformity tests for the verdicts
+        for (const auto& result : results) {
+            ostringstream test;
+            test << "Chi-Square (seed 0x" << hex << setw(16) << setfill('0') << result.seed << ")";
+            recordPValue(name, test.str(), twoSidedPValue(result.pValue));
+        }
+        recordPValue(name, "Seed Uniformity KS", kolmogorovSmirnov.pValue);
+        recordPValue(name, "Seed Uniformity AD", andersonDarling.pValue);
     }
 
-// Print a histogram of hash values, divided into 16 segments
-void printHistogram(const vector<int>& hashes) {
-    
-    // Define integer to store the maximum hash value
-    int maxCount = *max_element(hashes.begin(), hashes.end());
+    // Function to run all hash function tests
+    void runAllTests() {
 
-    // Define integer to store the minimum hash value
-    int minCount = *min_element(hashes.begin(), hashes.end());
+        // Test every registered hash function on the dictionary, and every seeded family over SEED_COUNT seeds
+        for (const auto& entry : hashFunctions) {
+            testHashFunction(entry);
+            if (entry.seededHashFunc) {
+                testSeededHashFunction(entry);
+            }
+        }
 
-    // Define vector of 16 integers initialized to 0 to store the maximum value for each segment
-    vector<int> segmentMaxCounts(16, 0);
-    for (size_t i = 0; i < 16; ++i) {
-        // Calculate the starting and ending indices for each segment
-        size_t start = i * 4096;
-        size_t end = min((i + 1) * 4096, hashes.size());
-        
-        // Find the maximum hash value within the current segment
-        auto segmentMax = *max_element(
-            hashes.begin() + start, 
-            hashes.begin() + end
-        );
-        // Store the segment's maximum value
-        segmentMaxCounts[i] = segmentMax;
+        // Correct the p-values of every test above and print the verdicts
+        printVerdicts("Dictionary Tests");
     }
 
+    // Function to run every registered hash against every corpus and table size
+    // Each (hash, corpus, table size) job is split into chunk tasks that run on a
+    // work-stealing pool, and a job's result is printed as soon as its last chunk finishes
+    // Cells the sequential screening rejected are not hashed again; they fail their hash in the verdicts
+    void runTestMatrix() {
 
-    // Normalize the maximum counts for each segment to fit within the histogram height
-    vector<int> normalizedSegments(16);
+        // Stores the state shared by the chunk tasks of one job; the job with the largest table also sketches
+        // the full outputs, and its chunks merge their sketches into outputSketch under sketchLock
+        struct MatrixJob {
+            const HashFunctionEntry* entry;
+            const Corpus* corpus;
+            size_t tableSize;
+            vector<uint16_t> buckets;
+            atomic<size_t> remainingChunks;
+            bool sketchOutputs;
+            mutex sketchLock;
+            HyperLogLog outputSketch;
+        };
 
-    // Iterate over the 16 segments of the hash data
-    for (size_t i = 0; i < 16; ++i) {
+        // Create one job per cell of the matrix
+        vector<unique_ptr<MatrixJob>> jobs;
+        size_t screenedKeys = 0;
+        for (const auto& entry : hashFunctions) {
+            for (const auto& corpus : corpora) {
 
-        // Normalize the maximum count for the current segment to fit within the histogram height
-        normalizedSegments[i] = round(
+                // An empty corpus has nothing to test
+                if (corpus.keys.empty()) {
+                    continue;
+                }
+                if (isScreenedOut(entry.name, corpus.name)) {
+                    recordScreenedOut(entry.name, corpus.name);
+                    screenedKeys += corpus.keys.size() * MATRIX_TABLE_SIZES.size();
+                    continue;
+                }
+                for (size_t tableSize : MATRIX_TABLE_SIZES) {
+                    unique_ptr<MatrixJob> job(new MatrixJob());
+                    job->entry = &entry;
+                    job->corpus = &corpus;
+                    job->tableSize = tableSize;
+                    job->buckets.resize(corpus.keys.size());
+                    job->remainingChunks = (corpus.keys.size() + MATRIX_CHUNK_SIZE - 1) / MATRIX_CHUNK_SIZE;
+                    job->sketchOutputs = tableSize == MATRIX_TABLE_SIZES.back();
+                    jobs.push_back(move(job));
+                }
+            }
+        }
 
-            // Subtract the minimum count to shift the range to start from 0
-            ((segmentMaxCounts[i] - minCount) /
+        // Lock serializing the streamed result lines, and the total time spent inside tasks
+        mutex outputLock;
+        atomic<long long> workNanoseconds{0};
 
-            // Divide by the range (maxCount - minCount) to scale the value between 0 and 1
-            static_cast<double>(maxCount - minCount)) * 
+        // Print the matrix header
+        printHorizontalLine(HISTOGRAM_WIDTH);
+        cout << "Test Matrix (" << jobs.size() << " jobs):" << endl;
+        printHorizontalLine(HISTOGRAM_WIDTH / 2);
 
-            // Multiply by (HISTOGRAM_HEIGHT - 1) to scale the value to fit within the histogram height range
-            (HISTOGRAM_HEIGHT - 1) 
-        );
-    }
+        // Print the distinct keys of every corpus, with the HyperLogLog estimate and its standard error
+        for (const auto& corpus : corpora) {
+            cout << left << setw(16) << corpus.name << right << setw(8) << corpus.distinctKeys << " distinct of "
+                 << setw(7) << corpus.keys.size() << " keys  (HyperLogLog " << llround(corpus.estimatedDistinctKeys)
+                 << " +/- " << 100.0 * HyperLogLog::standardError() << "%)" << endl;
+        }
+        printHorizontalLine(HISTOGRAM_WIDTH / 2);
 
+        auto wallStart = chrono::steady_clock::now();
+        size_t workerCount;
+        {
+            WorkStealingPool pool;
+            workerCount = pool.size();
 
+            for (auto& jobPointer : jobs) {
+                MatrixJob* job = jobPointer.get();
+                for (size_t begin = 0; begin < job->buckets.size(); begin += MATRIX_CHUNK_SIZE) {
+                    pool.submit([this, job, begin, &outputLock, &workNanoseconds]() {
+                        auto taskStart = chrono::steady_clock::now();
 
-        // Print histogram header
-        cout << "Histogram (Hashes Distribution):" << endl;
+                        // Hash this chunk's keys into the job's bucket array; chunks never overlap
+                        const vector<string>& keys = job->corpus->keys;
+                        size_t end = min(begin + MATRIX_CHUNK_SIZE, keys.size());
+                        if (job->sketchOutputs) {
+                            HyperLogLog chunkSketch;
+                            for (size_t i = begin; i < end; ++i) {
+                                uint64_t output = job->entry->hashFunc(keys[i]);
+                                job->buckets[i] = output % job->tableSize;
+                                chunkSketch.add(sketchValue(output));
+                            }
+                            lock_guard<mutex> guard(job->sketchLock);
+                            job->outputSketch.merge(chunkSketch);
+                        } else {
+                            for (size_t i = begin; i < end; ++i) {
+                                job->buckets[i] = job->entry->hashFunc(keys[i]) % job->tableSize;
+                            }
+                        }
 
-        // Print top line of histogram
-        printHorizontalLine(HISTOGRAM_WIDTH);
-    
-        // Loop through each row of the histogram, starting from the top (HISTOGRAM_HEIGHT - 1)
-        for (int row = HISTOGRAM_HEIGHT - 1; row >= 0; --row) {
+                        // The last chunk of a job builds the histogram of the distinct keys and reports the job;
+                        // beyond EXACT_DISTINCT_LIMIT no repeat is marked, and every key is counted
+                        if (--job->remainingChunks == 0) {
+                            vector<int> hashes(job->tableSize, 0);
+                            for (size_t i = 0; i < job->buckets.size(); ++i) {
+                                if (job->corpus->isCounted(i)) {
+                                    hashes[job->buckets[i]]++;
+                                }
+                            }
+                            size_t countedKeys = job->corpus->countedKeys();
+                            double chiSquare = computeChiSquare(hashes, countedKeys);
+                            double pValue = computePValue(chiSquare, job->tableSize - 1.0);
+                            OccupancyStatistic pairs = computeOccupancy(hashes, countedKeys).collidingPairs;
+                            double pairsZ = pairs.zScore();
+                            int maxLoad = computeMaxLoad(hashes);
+                            double collisionEntropy = computeEntropy(hashes, countedKeys).collision;
 
-            // Print the left border of the histogram
-            cout << "|";
+                            // The bucket array is no longer needed
+                            vector<uint16_t>().swap(job->buckets);
 
-            // Loop through each column (representing a segment) of the histogram
-            for (size_t col = 0; col < 16; ++col) {
+                            lock_guard<mutex> guard(outputLock);
+                            cout << left << setw(28) << job->entry->name << setw(16) << job->corpus->name
+                                 << right << setw(7) << job->tableSize
+                                 << "  Chi-Square: " << setw(12) << chiSquare
+                                 << "  P-Value: " << setw(12) << pValue
+                                 << "  Pairs z: " << setw(12) << pairsZ
+                                 << "  Max Load: " << setw(6) << maxLoad
+                                 << "  H2: " << collisionEntropy << " of " << log2(job->tableSize) << endl;
 
-                // Print a '#' character if the normalized value for the segment reaches or exceeds the current row
-                // Otherwise, print spaces for that segment's column
-                cout << (normalizedSegments[col] >= row ? "   #" : "    ");
+                            string cell = " (" + job->corpus->name + ", " + to_string(job->tableSize) + ")";
+                            recordPValue(job->entry->name, "Chi-Square" + cell, twoSidedPValue(pValue));
+                            recordPValue(job->entry->name, "Colliding Pairs" + cell, pairs.pValue());
+
+                            // Compare the sketched distinct outputs with those of a random oracle of the same width
+                            if (job->sketchOutputs) {
+                                OccupancyStatistic distinct = expectedDistinctOutputs(*job->corpus, job->entry->outputBits);
+                                distinct.observed = job->outputSketch.estimate();
+                                cout << left << setw(28) << job->entry->name << setw(16) << job->corpus->name << right
+                                     << "  Distinct Outputs: " << llround(distinct.observed) << " (expected "
+                                     << llround(distinct.expected) << ", z = " << distinct.zScore() << ")" << endl;
+                                recordPValue(job->entry->name, "Distinct Outputs (" + job->corpus->name + ")",
+                                    distinct.pValue());
+                            }
+                        }
+
+                        workNanoseconds += chrono::duration_cast<chrono::nanoseconds>(
+                            chrono::steady_clock::now() - taskStart).count();
+                    });
+                }
             }
 
-            // Print the right border and move to the next line
-            cout << "   |" << endl;
+            // Wait for every job to finish before the pool is destroyed
+            pool.wait();
         }
+        double wallSeconds = chrono::duration<double>(chrono::steady_clock::now() - wallStart).count();
+        double workSeconds = workNanoseconds / 1e9;
 
-        // Print bottom line of the histogram
+        // Compare the wall time with the ideal of total work divided by the worker count
+        printHorizontalLine(HISTOGRAM_WIDTH / 2);
+        cout << "Workers: " << workerCount << endl;
+        cout << "Total Work: " << workSeconds << " s" << endl;
+        cout << "Wall Time: " << wallSeconds << " s (ideal " << workSeconds / workerCount << " s)" << endl;
+        cout << "Parallel Efficiency: " << 100.0 * workSeconds / (wallSeconds * workerCount) << "%" << endl;
+        printScreeningSavings(screenedKeys);
+
+        // Correct the p-values of every cell above and print the verdicts
+        printVerdicts("Test Matrix");
+    }
+
+    // Function to screen every registered hash on every corpus with the sequential chi-square test
+    // Keys are visited in a fixed random order so that every prefix is a random sample of the corpus,
+    // and a hash stops being evaluated as soon as its non-uniformity is settled
+    // It runs before the test matrix; the matrix, bootstrap and sparse passes skip the cells it rejects
+    void runSequentialScreening() {
+
+        // Print the screening header
         printHorizontalLine(HISTOGRAM_WIDTH);
-        
-        // Print a space before the X-axis labels (segment numbers)
-        cout << " ";
+        cout << "Sequential Screening (checkpoint every " << SEQUENTIAL_CHECKPOINT_INTERVAL << " keys, "
+             << SEQUENTIAL_CONFIDENCE * 100 << "% confidence):" << endl;
+        printHorizontalLine(HISTOGRAM_WIDTH / 2);
 
-        // Iterate through 16 segments to print the labels (0 to 15)
-        for (int i = 0; i < 16; ++i) {
+        size_t keysHashed = 0;
+        size_t keysAvailable = 0;
+        for (const auto& corpus : corpora) {
 
-            // Print each segment number with a width of 4 characters for proper alignment
-            cout << setw(4) << i;
+            // Shuffle the visiting order of the distinct keys with a Fisher-Yates shuffle driven by the base seed
+            vector<size_t> order;
+            order.reserve(corpus.countedKeys());
+            for (size_t i = 0; i < corpus.keys.size(); ++i) {
+                if (corpus.isCounted(i)) {
+                    order.push_back(i);
+                }
+            }
+            uint64_t state = BASE_SEED;
+            for (size_t i = order.size(); i > 1; --i) {
+                swap(order[i - 1], order[splitMix64(state) % i]);
+            }
+
+            for (const auto& entry : hashFunctions) {
+                SequentialChiSquareTest test(pValueEngine, 65536, order.size(),
+                    SEQUENTIAL_CHECKPOINT_INTERVAL, SEQUENTIAL_CONFIDENCE);
+                for (size_t index : order) {
+                    if (test.add(entry.hashFunc(corpus.keys[index]) % 65536)) {
+                        break;
+                    }
+                }
+                keysHashed += test.keyCount();
+                keysAvailable += order.size();
+                if (test.isRejected()) {
+                    screenedOut.push_back({ entry.name, corpus.name });
+                }
+
+                cout << left << setw(28) << entry.name << setw(16) << corpus.name << right
+                     << (test.isRejected() ? "rejected after " : "completed all  ") << setw(7) << test.keyCount()
+                     << " keys (" << fixed << setprecision(1) << setw(5) << 100.0 * test.keyCount() / order.size()
+                     << "%)" << defaultfloat << setprecision(6) << "  Chi-Square: " << test.chiSquare() << endl;
+            }
         }
 
-        // Move to the next line after printing all the labels
-        cout << endl;
+        // Summarize how much hashing the early stops saved; the share depends on how many registered hashes are
+        // clearly bad, so the registry it was measured on is printed with it
+        printHorizontalLine(HISTOGRAM_WIDTH / 2);
+        cout << "Keys Hashed: " << keysHashed << " of " << keysAvailable << " ("
+             << fixed << setprecision(1) << 100.0 * (keysAvailable - keysHashed) / keysAvailable << "% saved over "
+             << hashFunctions.size() << " hashes x " << corpora.size() << " corpora)"
+             << defaultfloat << setprecision(6) << endl;
+        cout << "Cells Rejected: " << screenedOut.size() << " of " << hashFunctions.size() * corpora.size()
+             << ", skipped by the matrix, bootstrap and sparse passes" << endl;
     }
 
+    // Function to estimate the sampling noise of the distribution statistics by subsampling
+    // Every replicate keeps each key of the corpus with probability 1/2, without replacement, so no key is counted
+    // twice and the statistics of a replicate follow the single-sample expectations for the keys it kept; the
+    // 65536-bucket histogram is rebuilt from outputs hashed once per cell. Replicate r keeps the same keys for every
+    // hash, so the intervals of two hashes come from paired samples and can be compared directly
+    // Each (corpus, hash) cell hashes its corpus in a pool task, which then submits the cell's replicates
+    void runBootstrapAnalysis() {
 
-// Public constructor for the HashFunctionTester class
-public:
+        // Print the bootstrap header
+        printHorizontalLine(HISTOGRAM_WIDTH);
+        cout << "Bootstrap (" << BOOTSTRAP_REPLICATES << " half-samples without replacement, "
+             << BOOTSTRAP_CONFIDENCE * 100 << "% intervals, 65536 buckets):" << endl;
+        printHorizontalLine(HISTOGRAM_WIDTH / 2);
 
+        double lowerFraction = (1.0 - BOOTSTRAP_CONFIDENCE) / 2.0;
+        double upperFraction = 1.0 - lowerFraction;
 
-    // Initializes an object of HashFunctionTester
-    HashFunctionTester() {
+        // Stores the outputs and the per-replicate results of one cell; one slot per replicate, so tasks write
+        // their results without locking, and the last replicate task frees the outputs
+        struct BootstrapCell {
+            const Corpus* corpus;
+            const HashFunctionEntry* entry;
+            vector<uint64_t> outputs;
+            vector<double> chiSquares;
+            vector<double> maxLoads;
+            vector<double> pairsZ;
+            atomic<int> remainingTasks;
+        };
+        int tasksPerCell = (BOOTSTRAP_REPLICATES + BOOTSTRAP_REPLICATES_PER_TASK - 1) / BOOTSTRAP_REPLICATES_PER_TASK;
+        vector<unique_ptr<BootstrapCell>> cells;
+        size_t screenedKeys = 0;
+        for (const auto& corpus : corpora) {
+            for (const auto& entry : hashFunctions) {
+                if (isScreenedOut(entry.name, corpus.name)) {
+                    screenedKeys += corpus.countedKeys();
+                    continue;
+                }
+                unique_ptr<BootstrapCell> cell(new BootstrapCell());
+                cell->corpus = &corpus;
+                cell->entry = &entry;
+                cell->chiSquares.resize(BOOTSTRAP_REPLICATES);
+                cell->maxLoads.resize(BOOTSTRAP_REPLICATES);
+                cell->pairsZ.resize(BOOTSTRAP_REPLICATES);
+                cell->remainingTasks = tasksPerCell;
+                cells.push_back(move(cell));
+            }
+        }
 
-        // Calls the loadDictionary function to populate the 'words' vector with words
-        loadDictionary(); 
-    }
+        {
+            WorkStealingPool pool;
+            for (auto& cellPointer : cells) {
+                BootstrapCell* cell = cellPointer.get();
+                pool.submit([this, cell, &pool]() {
 
-    // Function to test a hash function and print a histogram of hash results
-    // Accepts the name of the hash function and the hash function itself as arguments
-    void testHashFunction(const string& name, 
-        const function<uint16_t(const string&)>& hashFunc) {
+                    // Hash the distinct keys of the corpus once; every replicate reads these outputs
+                    const Corpus& corpus = *cell->corpus;
+                    cell->outputs.reserve(corpus.countedKeys());
+                    for (size_t i = 0; i < corpus.keys.size(); ++i) {
+                        if (corpus.isCounted(i)) {
+                            cell->outputs.push_back(cell->entry->hashFunc(corpus.keys[i]));
+                        }
+                    }
 
-        // Create a vector to store the hash results, initialized to 0 with a size of 65536
-        vector<int> hashes(65536, 0);
+                    for (int first = 0; first < BOOTSTRAP_REPLICATES; first += BOOTSTRAP_REPLICATES_PER_TASK) {
+                        pool.submit([this, cell, first]() {
+                            vector<int> hashes(65536);
+                            int last = min(first + BOOTSTRAP_REPLICATES_PER_TASK, BOOTSTRAP_REPLICATES);
+                            for (int replicate = first; replicate < last; ++replicate) {
+                                fill(hashes.begin(), hashes.end(), 0);
 
-        // Iterate through each word in the 'words' vector
-        for (const auto& word : words) {
+                                // Keep each key on the top bit of the replicate's own random stream
+                                uint64_t state = BASE_SEED + replicate;
+                                size_t kept = 0;
+                                for (uint64_t output : cell->outputs) {
+                                    if (splitMix64(state) >> 63) {
+                                        hashes[output % 65536]++;
+                                        ++kept;
+                                    }
+                                }
 
-            // Define a 16-bit unsigned integer for the resulting hash of the current word
-            uint16_t h = hashFunc(word);
+                                cell->chiSquares[replicate] = computeChiSquare(hashes, kept);
+                                cell->maxLoads[replicate] = computeMaxLoad(hashes);
+                                cell->pairsZ[replicate] = computeOccupancy(hashes, kept).collidingPairs.zScore();
+                            }
+                            if (--cell->remainingTasks == 0) {
+                                vector<uint64_t>().swap(cell->outputs);
+                            }
+                        });
+                    }
+                });
+            }
+            pool.wait();
+        }
 
-            // Increment the corresponding hash bucket in the 'hashes' vector
-            hashes[h]++;
+        // Percentile intervals of every statistic, printed in registration order
+        for (auto& cell : cells) {
+            sort(cell->chiSquares.begin(), cell->chiSquares.end());
+            sort(cell->maxLoads.begin(), cell->maxLoads.end());
+            sort(cell->pairsZ.begin(), cell->pairsZ.end());
+            cout << left << setw(28) << cell->entry->name << setw(16) << cell->corpus->name << right
+                 << "  Chi-Square: [" << setw(9) << percentile(cell->chiSquares, lowerFraction)
+                 << ", " << setw(9) << percentile(cell->chiSquares, upperFraction) << "]"
+                 << "  Max Load: [" << percentile(cell->maxLoads, lowerFraction)
+                 << ", " << percentile(cell->maxLoads, upperFraction) << "]"
+                 << "  Pairs z: [" << percentile(cell->pairsZ, lowerFraction)
+                 << ", " << percentile(cell->pairsZ, upperFraction) << "]" << endl;
         }
 
-        // Compute the chi-square statistic based on the hash distribution
-        float chiSquare = computeChiSquare(hashes);
+        // Half-samples of a random oracle give chi-square intervals around 65535 and pair z-scores around 0
+        printHorizontalLine(HISTOGRAM_WIDTH / 2);
+        cout << "Note: each replicate keeps about half of the corpus without repeats, so the statistics follow the "
+             << "single-sample expectations for the keys it kept" << endl;
+        printScreeningSavings(screenedKeys);
+    }
 
-        // Compute the p-value from the chi-square statistic
-        float pValue = computePValue(chiSquare);
+    // Function to run a two-level test on every hash and corpus
+    // Each corpus is cut into disjoint contiguous slices, every slice gets its own chi-square test, and the
+    // slice p-values, uniform on (0, 1) for a random oracle, are tested for uniformity with Kolmogorov-Smirnov
+    // and Anderson-Darling; a bias confined to some key ranges, or too-even slices, shows up here even when
+    // the whole-corpus test passes
+    void runTwoLevelTests() {
 
-        // Print a horizontal line as a divider between the tests
+        // Print the two-level header
         printHorizontalLine(HISTOGRAM_WIDTH);
+        cout << "Two-Level Test (" << TWO_LEVEL_SLICES << " slices, " << TWO_LEVEL_BUCKETS << " buckets each):" << endl;
+        printHorizontalLine(HISTOGRAM_WIDTH / 2);
 
-        // Print the hash function's name
-        cout << name << " Hash:" << endl;
+        WorkStealingPool pool;
+        for (const auto& corpus : corpora) {
 
-        // Print another horizontal line of half the width
+            // Slice the distinct keys in corpus order
+            vector<size_t> counted;
+            counted.reserve(corpus.countedKeys());
+            for (size_t i = 0; i < corpus.keys.size(); ++i) {
+                if (corpus.isCounted(i)) {
+                    counted.push_back(i);
+                }
+            }
+            size_t sliceSize = counted.size() / TWO_LEVEL_SLICES;
+
+            // A corpus with fewer keys than slices leaves every slice empty
+            if (sliceSize == 0) {
+                continue;
+            }
+            for (const auto& entry : hashFunctions) {
+
+                // One slot per slice, so tasks write their p-values without locking
+                vector<double> pValues(TWO_LEVEL_SLICES);
+                for (size_t slice = 0; slice < TWO_LEVEL_SLICES; ++slice) {
+                    pool.submit([&, slice]() {
+                        vector<int> hashes(TWO_LEVEL_BUCKETS, 0);
+                        for (size_t i = slice * sliceSize; i < (slice + 1) * sliceSize; ++i) {
+                            hashes[entry.hashFunc(corpus.keys[counted[i]]) % TWO_LEVEL_BUCKETS]++;
+                        }
+                        pValues[slice] = computePValue(computeChiSquare(hashes, sliceSize), TWO_LEVEL_BUCKETS - 1.0);
+                    });
+                }
+                pool.wait();
+
+                // Test the slice p-values for uniformity
+                sort(pValues.begin(), pValues.end());
+                TestResult kolmogorovSmirnov = kolmogorovSmirnovUniform(pValues);
+                TestResult andersonDarling = andersonDarlingUniform(pValues);
+                cout << left << setw(28) << entry.name << setw(16) << corpus.name << right
+                     << "  KS D: " << setw(9) << kolmogorovSmirnov.statistic
+                     << " (P-Value: " << setw(12) << kolmogorovSmirnov.pValue << ")"
+                     << "  AD A^2: " << setw(9) << andersonDarling.statistic
+                     << " (P-Value: " << andersonDarling.pValue << ")" << endl;
+
+                recordPValue(entry.name, "Two-Level KS (" + corpus.name + ")", kolmogorovSmirnov.pValue);
+                recordPValue(entry.name, "Two-Level AD (" + corpus.name + ")", andersonDarling.pValue);
+            }
+        }
+
+        // Correct the p-values of every cell above and print the verdicts
+        printVerdicts("Two-Level Test");
+    }
+
+    // Function to test the hashes with enough output bits on bucket spaces far larger than memory
+    // Tables up to compactTableLimit() buckets are counted densely in one-byte compact counters by countBuckets,
+    // which picks direct increments or the partitioned engine by table size. Every table also gets a sparse
+    // histogram, whose buckets are radix sorted and counted by runs, so its memory follows the number of keys; it
+    // evaluates the larger tables and must agree exactly with the compact counters on the others, as must int
+    // counters up to INT_CHECK_LIMIT
+    void runSparseTableTests() {
+        uint64_t compactLimit = compactTableLimit();
+
+        // Print the large-table header
+        printHorizontalLine(HISTOGRAM_WIDTH);
+        cout << "Sparse Table Tests (compact counters up to 2^" << floor(log2(static_cast<double>(compactLimit)))
+             << " buckets, sorted histograms beyond):" << endl;
         printHorizontalLine(HISTOGRAM_WIDTH / 2);
 
-        // Print the chi-square value
-        cout << "Chi-Square: " << chiSquare << endl;
+        size_t screenedKeys = 0;
+        for (const auto& entry : hashFunctions) {
 
-        // Print the p-value
-        cout << "P-Value: " << pValue << endl;   
+            // 16-bit hashes are covered by the dense test matrix
+            if (entry.outputBits < 32) {
+                continue;
+            }
+            // A 128-bit output is tested on each of its 64-bit halves
+            vector<pair<string, function<uint64_t(const string&)>>> halves = { { "", entry.hashFunc } };
+            if (entry.wideHashFunc) {
+                halves = {
+                    { " Low", entry.hashFunc },
+                    { " High", [&entry](const string& key) { return entry.wideHashFunc(key).high; } },
+                };
+            }
+            for (const auto& half : halves) {
+                for (const auto& corpus : corpora) {
+                    size_t keyCount = corpus.countedKeys();
+                    if (keyCount == 0) {
+                        continue;
+                    }
+                    if (isScreenedOut(entry.name, corpus.name)) {
+                        if (entry.sparseGated && half.first == halves.front().first) {
+                            recordScreenedOut(entry.name, corpus.name);
+                        }
+                        screenedKeys += keyCount;
+                        continue;
+                    }
+                    vector<uint64_t> outputs;
+                    outputs.reserve(keyCount);
+                    for (size_t i = 0; i < corpus.keys.size(); ++i) {
+                        if (corpus.isCounted(i)) {
+                            outputs.push_back(half.second(corpus.keys[i]));
+                        }
+                    }
 
-        // Print the histogram of hash results
-        printHistogram(hashes);
+                    for (uint64_t tableSize : SPARSE_TABLE_SIZES) {
+
+                        // A hash cannot fill more buckets than it has outputs
+                        if (entry.outputBits < 64 && tableSize > (1ULL << entry.outputBits)) {
+                            continue;
+                        }
+
+                        vector<uint64_t> buckets(keyCount);
+                        for (size_t i = 0; i < keyCount; ++i) {
+                            buckets[i] = outputs[i] % tableSize;
+                        }
+                        SparseHistogram histogram = buildSparseHistogram(move(buckets), tableSize);
+
+                        double chiSquare = computeChiSquare(histogram, keyCount);
+                        OccupancyStatistic pairs = computeOccupancy(histogram.loads, keyCount, tableSize).collidingPairs;
+                        uint64_t maxLoad = computeMaxLoad(histogram.loads);
+
+                        // Count the table densely where it fits; the sparse histogram must give exactly the same statistics
+                        if (tableSize <= compactLimit) {
+                            vector<uint32_t> denseBuckets(keyCount);
+                            for (size_t i = 0; i < keyCount; ++i) {
+                                denseBuckets[i] = static_cast<uint32_t>(outputs[i] % tableSize);
+                            }
+                            CompactCounterArray counts(tableSize);
+                            countBuckets(denseBuckets.data(), keyCount, counts);
+                            double compactChiSquare = computeChiSquare(counts, keyCount);
+                            OccupancyStatistic compactPairs = computeOccupancy(counts, keyCount).collidingPairs;
+                            uint64_t compactMaxLoad = computeMaxLoad(counts);
+                            if (compactChiSquare != chiSquare || compactPairs.observed != pairs.observed
+                                || compactMaxLoad != maxLoad) {
+                                throw runtime_error("Sparse histogram disagrees with the compact counters for " + entry.name);
+                            }
+
+                            // So must int counters, where they fit too
+                            if (tableSize <= INT_CHECK_LIMIT) {
+                                vector<int> hashes(tableSize, 0);
+                                countBuckets(denseBuckets.data(), keyCount, hashes);
+                                if (computeChiSquare(hashes, keyCount) != chiSquare
+                                    || computeOccupancy(hashes, keyCount).collidingPairs.observed != pairs.observed
+                                    || computeLoadDistribution(hashes).bucketsWithLoad
+                                        != computeLoadDistribution(histogram.loads, tableSize).bucketsWithLoad) {
+                                    throw runtime_error("Int counters disagree with the compact ones for " + entry.name);
+                                }
+                            }
+                            chiSquare = compactChiSquare;
+                            pairs = compactPairs;
+                            maxLoad = compactMaxLoad;
+                        }
+                        // Every histogram has sum(c^2) = N + 2 pairs, so chi-square is exactly B (N + 2 pairs) / N - N:
+                        // it moves in steps of 2B / N as pairs arrive one at a time, and its chi-square(B - 1) tail only
+                        // holds while many pairs are expected; with fewer, one pair more than expected in a table far
+                        // larger than the corpus reads as z = 14, so only the exact pair test is recorded
+                        bool chiSquareRecorded = pairs.expected >= OccupancyStatistic::POISSON_LIMIT;
+                        double pValue = computePValue(chiSquare, tableSize - 1.0);
+
+                        cout << left << setw(28) << entry.name + half.first << setw(16) << corpus.name << right
+                             << "  2^" << setw(2) << log2(static_cast<double>(tableSize))
+                             << "  Chi-Square: " << setw(14) << chiSquare << "  P-Value: " << setw(12);
+                        if (chiSquareRecorded) {
+                            cout << pValue;
+                        } else {
+                            cout << "(pairs)";
+                        }
+                        cout << "  Colliding Pairs: " << pairs.observed << " (expected " << pairs.expected
+                             << ", P-Value: " << pairs.pValue() << ")"
+                             << "  Max Load: " << maxLoad << endl;
+
+                        if (!entry.sparseGated) {
+                            continue;
+                        }
+                        string cell = half.first + " (" + corpus.name + ", 2^" + to_string(static_cast<int>(log2(tableSize))) + ")";
+                        if (chiSquareRecorded) {
+                            recordPValue(entry.name, "Chi-Square" + cell, twoSidedPValue(pValue));
+                        }
+                        recordPValue(entry.name, "Colliding Pairs" + cell, pairs.pValue());
+                    }
+                }
+            }
+        }
+
+        printHorizontalLine(HISTOGRAM_WIDTH / 2);
+        printScreeningSavings(screenedKeys);
+
+        // Correct the p-values of every cell above and print the verdicts
+        printVerdicts("Sparse Table Tests");
+        for (const auto& entry : hashFunctions) {
+            if (entry.outputBits >= 32 && !entry.sparseGated) {
+                cout << left << setw(28) << entry.name << setw(12) << "NOT GATED" << right << "  reported above; "
+                     << entry.outputBits << "-bit output of a linear code, more injective than a random function" << endl;
+            }
+        }
     }
 
-    // Function to run all hash function tests
-    void runAllTests() {
+    // Function to run the avalanche test on every registered hash function
+    void runAvalancheTests() {
 
-        // String Length Hash Test
-        // This test hashes a string based on its length modulo 65536
-        testHashFunction("String Length", [](const string& word) {
-            return word.length() % 65536;  // Return the length of the string modulo 65536
-        });
+        // Print the avalanche header
+        printHorizontalLine(HISTOGRAM_WIDTH);
+        cout << "Avalanche Tests (" << AVALANCHE_KEYS << " random keys, every input bit flipped; bias is |2 P(flip) - 1|):" << endl;
+        printHorizontalLine(HISTOGRAM_WIDTH / 2);
 
-        // First Character Hash Test
-        // This test hashes a string based on the first character (sanitized) modulo 65536
-        testHashFunction("First Character", [this](const string& word) {
-            return word.empty() ? 0 : sanitizeChar(word[0]) % 65536;  // If empty, return 0, else sanitize and hash the first character
-        });
+        for (const auto& entry : hashFunctions) {
+            for (size_t keyLength : AVALANCHE_KEY_LENGTHS) {
+                AvalancheResult avalanche = computeAvalanche(entry, keyLength);
+                double pValue = exp(pValueEngine.tails(avalanche.chiSquare, avalanche.degreesOfFreedom).logUpper);
 
-        // Additive Checksum Hash Test
-        // This test computes a checksum by adding sanitized character values modulo 65536
-        testHashFunction("Additive Checksum", [this](const string& word) {
-            uint16_t h = 0;  // Initialize checksum value
-            for (char c : word) {
-                h = (h + sanitizeChar(c)) % 65536;  // Add sanitized char to checksum, taking modulo 65536
+                cout << left << setw(28) << entry.name << right << setw(3) << keyLength << " bytes"
+                     << fixed << setprecision(4) << "  Mean Flip: " << avalanche.meanFlip
+                     << setprecision(2) << "  Worst Bias: " << setw(6) << 100.0 * avalanche.worstBias << "%"
+                     << " (input bit " << setw(3) << avalanche.worstInputBit
+                     << ", output bit " << setw(3) << avalanche.worstOutputBit << ")"
+                     << defaultfloat << setprecision(6)
+                     << "  Chi-Square: " << setw(12) << avalanche.chiSquare
+                     << "  P-Value: " << setw(12) << pValue << endl;
+
+                recordPValue(entry.name, "Avalanche (" + to_string(keyLength) + " bytes)", pValue);
             }
-            return h;  // Return the checksum value
-        });
+        }
 
-        // Remainder Hash Test
-        // This test computes a hash by multiplying the current hash by 31, adding the sanitized character, and taking the remainder modulo 65413
-        testHashFunction("Remainder", [this](const string& word) {
-            const uint16_t m = 65413;  // Define modulus value
-            uint16_t h = 0;  // Initialize hash value
-            for (char c : word) {
-                h = (h * 31 + sanitizeChar(c)) % m;  // Update hash by multiplying by 31 and adding sanitized character
+        // Correct the p-values of every key length and print the verdicts
+        printVerdicts("Avalanche Tests");
+    }
+
+    // Function to run the throughput benchmarks
+    void runThroughputBenchmarks() {
+
+        // Print the benchmark header
+        printHorizontalLine(HISTOGRAM_WIDTH);
+        cout << "Throughput Benchmarks (" << BENCHMARK_REPETITIONS << " passes per key set):" << endl;
+        printHorizontalLine(HISTOGRAM_WIDTH / 2);
+
+        // Short keys (the dictionary), longer keys (word phrases) and keys of about 1 KiB;
+        // out-of-order execution already overlaps the chains of consecutive short keys,
+        // so removing the per-character dependency mainly pays off on long keys
+        Corpus longKeys = { "Long Keys", {}, 0, 0.0, {} };
+        string longKey;
+        for (const auto& word : words) {
+            longKey += word;
+            if (longKey.size() >= 1024) {
+                longKeys.keys.push_back(longKey);
+                longKey.clear();
             }
-            return h;  // Return the final hash value
+        }
+        const vector<const Corpus*> keySets = { &corpora[0], &corpora[2], &longKeys };
+
+        // Every registered hash function, byte-at-a-time FNV-1a against its word-at-a-time variant and MurmurHash3
+        // in particular
+        benchmarkAllHashFunctions(keySets);
+        benchmarkAllCyclesPerByte();
+
+        // Remainder hash, one key at a time versus 4, 8 and 16 interleaved keys
+        benchmarkKernelFamily("Remainder", "interleaved keys", keySets, {
+            { "1 lane", [this](const string* keys, size_t count, uint16_t* out) { remainderHashBatch<1>(keys, count, out); } },
+            { "4 lanes", [this](const string* keys, size_t count, uint16_t* out) { remainderHashBatch<4>(keys, count, out); } },
+            { "8 lanes", [this](const string* keys, size_t count, uint16_t* out) { remainderHashBatch<8>(keys, count, out); } },
+            { "16 lanes", [this](const string* keys, size_t count, uint16_t* out) { remainderHashBatch<16>(keys, count, out); } },
         });
 
-        // Multiplicative Hash Test
-        // This test uses a multiplicative approach with a constant factor (0.6180339887) to generate the hash
-        testHashFunction("Multiplicative", [this](const string& word) {
-            double h = 0.0;  // Initialize hash value as a floating-point number
-            for (char c : word) {
-                h = fmod(h * 0.6180339887 + sanitizeChar(c), 1.0);  // Update hash using floating-point multiplication and sanitize char
-            }
-            return static_cast<uint16_t>(h * 65536);  // Scale the result to a uint16_t and return
+        // Remainder hash, Horner's rule versus the unrolled and lazily reduced polynomial kernels
+        benchmarkKernelFamily("Remainder", "polynomial kernels", keySets, {
+            { "unrolled x4", [this](const string* keys, size_t count, uint16_t* out) {
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = remainderHashUnrolled4(keys[i]);
+                }
+            } },
+            { "unrolled x8", [this](const string* keys, size_t count, uint16_t* out) {
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = remainderHashUnrolled8(keys[i]);
+                }
+            } },
+            { "lazy 64-bit", [this](const string* keys, size_t count, uint16_t* out) {
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = remainderHashLazy64(keys[i]);
+                }
+            } },
         });
 
-        // Standard Library Hash Test
-        // This test uses the standard C++ hash function to hash the string and takes modulo 65536
-        testHashFunction("Standard Library", [](const string& word) {
-            return hash<string>{}(word) % 65536;  // Use the standard C++ hash function and return modulo 65536
+        // Exact integer chi-square kernel for each counter width, at table and sweep sizes
+        cout << "Chi-Square Kernel:" << endl;
+        for (size_t bucketCount : { size_t(1) << 16, size_t(1) << 24 }) {
+            benchmarkChiSquareKernel<uint16_t>("u16", bucketCount);
+            benchmarkChiSquareKernel<uint32_t>("u32", bucketCount);
+            benchmarkChiSquareKernel<uint64_t>("u64", bucketCount);
+        }
+
+        // Direct increments versus the partitioned counting engine, across the cache-size crossover
+        cout << "Bucket Counting (2^22 random keys):" << endl;
+        size_t directFastest = 0;
+        for (int bits = 12; bits <= 26; bits += 2) {
+            if (benchmarkBucketCounting(size_t(1) << bits)) {
+                directFastest = size_t(1) << bits;
+            }
+        }
+        cout << "  countBuckets counts up to " << directCountLimit / 1024 << " KiB of counters directly, as calibrated at"
+             << " startup; direct increments were fastest up to " << directFastest * sizeof(int) / 1024
+             << " KiB of int counters here" << endl;
+
+        // P-value engine accuracy against Boost and cost per p-value
+        cout << "P-Value Engine:" << endl;
+        for (double degreesOfFreedom : { 1.0, 9.0, 99.0, 255.0, 1023.0, 65535.0, 16777215.0 }) {
+            benchmarkPValueEngine(degreesOfFreedom);
+        }
+
+        // Floating-point Multiplicative hash versus its fixed-point replacement
+        compareHashFunctions("Multiplicative", "Fixed-Point Multiplicative", keySets);
+
+        // Standard library hash versus wyhash, on short dictionary words up to 1 KiB keys
+        compareHashFunctions("Standard Library", "wyhash", keySets);
+
+        // The fastest multiply-based hash versus AES rounds
+        compareHashFunctions("wyhash", "AES Hash", keySets);
+
+        // Multiplicative hash, one key at a time versus 4, 8 and 16 interleaved keys
+        benchmarkKernelFamily("Multiplicative", "interleaved keys", keySets, {
+            { "1 lane", [this](const string* keys, size_t count, uint16_t* out) { multiplicativeHashBatch<1>(keys, count, out); } },
+            { "4 lanes", [this](const string* keys, size_t count, uint16_t* out) { multiplicativeHashBatch<4>(keys, count, out); } },
+            { "8 lanes", [this](const string* keys, size_t count, uint16_t* out) { multiplicativeHashBatch<8>(keys, count, out); } },
+            { "16 lanes", [this](const string* keys, size_t count, uint16_t* out) { multiplicativeHashBatch<16>(keys, count, out); } },
         });
     }
 
 };
 
+constexpr size_t HashFunctionTester::CHI_SQUARE_BLOCK;
+constexpr int HashFunctionTester::LOAD_DISTRIBUTION_LIMIT;
+constexpr int HashFunctionTester::RADIX_BITS;
+constexpr int HashFunctionTester::PARTITION_SPAN_BITS;
+constexpr size_t HashFunctionTester::MAX_PARTITIONS;
+constexpr size_t HashFunctionTester::COMBINE_SLOTS;
+
 
 // Main function
 int main() {
@@ -301,6 +5096,13 @@ int main() {
         // Create a HashFunctionTester object and run all hash function tests
         HashFunctionTester tester;
         tester.runAllTests();
+        tester.runSequentialScreening();
+        tester.runTestMatrix();
+        tester.runBootstrapAnalysis();
+        tester.runTwoLevelTests();
+        tester.runSparseTableTests();
+        tester.runAvalancheTests();
+        tester.runThroughputBenchmarks();
     }
     catch (const exception& e) {
         // If an exception occurs, print the error message